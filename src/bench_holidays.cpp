@@ -0,0 +1,119 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <chrono>
+
+#include "date.h"
+#include "holidays.h"
+
+// Times holiday evaluation and the date primitives over 1900-2400.
+// Usage: bench_holidays [iterations]
+
+const int FIRST_YEAR = 1900;
+const int LAST_YEAR = 2400;
+
+// Keeps results alive so that the compiler cannot drop the work.
+volatile long sink;
+
+// Runs f(iteration) the given number of times and prints the time per op,
+// where each call of f does ops_per_iteration ops.
+template <typename F>
+void bench(const char *name, int iterations, long ops_per_iteration, F f) {
+	auto start = std::chrono::steady_clock::now();
+	long result = 0;
+	for (int i = 0; i < iterations; i++) {
+		result += f(i);
+	}
+	std::chrono::duration<double, std::nano> elapsed =
+		std::chrono::steady_clock::now() - start;
+	sink = result;
+
+	long ops = ops_per_iteration * iterations;
+	printf("%-32s %12ld ops %10.2f ns/op\n", name, ops, elapsed.count() / ops);
+}
+
+int main(int argc, char *argv[])
+{
+	int iterations = argc > 1 ? atoi(argv[1]) : 20;
+	if (iterations <= 0) {
+		fprintf(stderr, "Usage: %s [iterations]\n", argv[0]);
+		return EXIT_FAILURE;
+	}
+
+	const int first_day = days_from_civil(FIRST_YEAR, 1, 1);
+	const int last_day = days_from_civil(LAST_YEAR + 1, 1, 1);
+	const long num_days = last_day - first_day;
+	const long num_years = LAST_YEAR - FIRST_YEAR + 1;
+	HolidayTable table;
+
+	bench("is_holiday (US, per day)", iterations, num_days, [&](int) {
+		long count = 0;
+		for (int d = first_day; d < last_day; d++) {
+			count += is_holiday(d);
+		}
+		return count;
+	});
+	bench("HolidayTable::is_holiday", iterations, num_days, [&](int) {
+		long count = 0;
+		for (int d = first_day; d < last_day; d++) {
+			count += table.is_holiday(d);
+		}
+		return count;
+	});
+	bench("HolidayTable::compute_mask", iterations, num_years, [&](int) {
+		long count = 0;
+		for (int y = FIRST_YEAR; y <= LAST_YEAR; y++) {
+			count += table.compute_mask(y).count();
+		}
+		return count;
+	});
+	// Times only lookups of cached masks.
+	for (int y = FIRST_YEAR; y <= LAST_YEAR; y++) {
+		table.get_mask(y);
+	}
+	bench("HolidayTable::get_mask (cached)", iterations, num_years, [&](int) {
+		long count = 0;
+		for (int y = FIRST_YEAR; y <= LAST_YEAR; y++) {
+			count += table.get_mask(y).count();
+		}
+		return count;
+	});
+
+	bench("days_from_civil", iterations, num_days, [&](int) {
+		long sum = 0;
+		for (int y = FIRST_YEAR; y <= LAST_YEAR; y++) {
+			for (int m = 1; m <= 12; m++) {
+				for (int d = 1; d <= days_in_month(y, m); d++) {
+					sum += days_from_civil(y, m, d);
+				}
+			}
+		}
+		return sum;
+	});
+	bench("civil_from_days", iterations, num_days, [&](int) {
+		long sum = 0;
+		for (int d = first_day; d < last_day; d++) {
+			Date date = civil_from_days(d);
+			sum += date.year + date.month + date.day;
+		}
+		return sum;
+	});
+	bench("weekday_from_days", iterations, num_days, [&](int) {
+		long sum = 0;
+		for (int d = first_day; d < last_day; d++) {
+			sum += weekday_from_days(d);
+		}
+		return sum;
+	});
+	// Walks the days the way the renderer does.
+	bench("for_each_day", iterations, num_days, [&](int) {
+		long sum = 0;
+		for (int y = FIRST_YEAR; y <= LAST_YEAR; y++) {
+			for_each_day(y, [&](const Date& date, int yday, int wday) {
+				sum += date.day + yday + wday;
+			});
+		}
+		return sum;
+	});
+	return EXIT_SUCCESS;
+}
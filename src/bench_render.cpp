@@ -0,0 +1,263 @@
+#include <errno.h>
+#include <google/protobuf/text_format.h>
+#include <spdlog/spdlog.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/resource.h>
+#include <sys/time.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "calendar.h"
+#include "config.pb.h"
+
+// Renders synthetic or given configs through the full pipeline, each in its
+// own process, and reports wall time, peak RSS and output bytes.
+//
+// Usage: bench_render [--write-configs DIR] [CONFIG...]
+//
+// Without CONFIG files, a sweep of synthetic configs is rendered, each
+// varying one of num_years, special day count, cell_size, icon complexity
+// and output_type from a baseline. --write-configs writes the sweep out as
+// text format configs instead.
+
+struct SyntheticParams {
+	std::string name;
+	int num_years;
+	int num_special_days;
+	double cell_size;
+	// Paths in each icon; 0 for no icons.
+	int icon_paths;
+	config::OutputType output_type;
+};
+
+const int START_YEAR = 2020;
+// Distinct icons among the special days.
+const int NUM_ICONS = 4;
+
+void set_rgb(config::RGB *rgb, int red, int green, int blue) {
+	rgb->set_red(red);
+	rgb->set_green(green);
+	rgb->set_blue(blue);
+}
+
+// An icon of num_paths random triangles. seed picks which one.
+std::string make_icon(int num_paths, unsigned seed) {
+	std::ostringstream svg;
+	svg << "<svg xmlns=\"http://www.w3.org/2000/svg\" width=\"512\" "
+		"height=\"512\" viewBox=\"0 0 512 512\">";
+	unsigned state = seed * 2654435761u + 1;
+	for (int i = 0; i < num_paths; i++) {
+		svg << "<path d=\"M";
+		for (int j = 0; j < 3; j++) {
+			state = state * 1664525u + 1013904223u;
+			svg << " " << (state >> 8) % 512;
+			state = state * 1664525u + 1013904223u;
+			svg << " " << (state >> 8) % 512;
+		}
+		svg << " Z\"/>";
+	}
+	svg << "</svg>";
+	return svg.str();
+}
+
+config::CalendarConfig make_config(const SyntheticParams& params) {
+	config::CalendarConfig conf;
+	double cell = params.cell_size;
+	conf.set_num_years(params.num_years);
+	conf.set_start_year(START_YEAR);
+	conf.set_cell_size(cell);
+	conf.set_cell_margin(cell / 4);
+	conf.set_font_size(cell * 9 / 16);
+	conf.set_bigger_font_size(cell * 12 / 16);
+	conf.set_line_width(1);
+	conf.set_month_label_height(cell * 5 / 2);
+	conf.set_year_label_width(cell * 15 / 4);
+	set_rgb(conf.mutable_rgb_header(), 117, 117, 117);
+	set_rgb(conf.mutable_rgb_header_sunday(), 244, 67, 54);
+	set_rgb(conf.mutable_rgb_month_line(), 189, 189, 189);
+	set_rgb(conf.mutable_rgb_holiday(), 244, 67, 54);
+	conf.set_bottom_left_label("Synthetic calendar");
+	conf.set_bottom_right_label(params.name);
+	conf.set_header_font_family("Sans");
+	conf.set_number_font_family("Sans");
+	conf.set_quote_font_family("Serif");
+	conf.set_output_type(params.output_type);
+	conf.set_output_name(params.name);
+
+	std::vector<std::string> icons;
+	for (int i = 0; params.icon_paths > 0 && i < NUM_ICONS; i++) {
+		icons.push_back(make_icon(params.icon_paths, i));
+	}
+	// 12 months of 28 days give 336 dates a year. The first round recurs
+	// every year; later ones fall on a single year each.
+	for (int i = 0; i < params.num_special_days; i++) {
+		config::SpecialDay *d = conf.add_special_day();
+		d->set_month(1 + i % 12);
+		d->set_day(1 + i / 12 % 28);
+		if (i < 336) {
+			d->set_first_year(START_YEAR - i % 10);
+		} else {
+			d->set_year(START_YEAR + i / 336 % params.num_years);
+		}
+		set_rgb(d->mutable_rgb(), i * 37 % 256, i * 59 % 256, i * 83 % 256);
+		if (!icons.empty()) {
+			d->set_svg(icons[i % icons.size()]);
+		}
+	}
+	return conf;
+}
+
+std::vector<SyntheticParams> get_sweep() {
+	const SyntheticParams base =
+		{"base", 30, 100, 16, 10, config::OutputType::SVG};
+	std::vector<SyntheticParams> sweep = {base};
+	for (int num_years : {10, 100, 1000}) {
+		SyntheticParams params = base;
+		params.name = "years-" + std::to_string(num_years);
+		params.num_years = num_years;
+		sweep.push_back(params);
+	}
+	for (int num_special_days : {0, 1000, 10000}) {
+		SyntheticParams params = base;
+		params.name = "special-days-" + std::to_string(num_special_days);
+		params.num_special_days = num_special_days;
+		sweep.push_back(params);
+	}
+	for (int cell_size : {8, 32}) {
+		SyntheticParams params = base;
+		params.name = "cell-size-" + std::to_string(cell_size);
+		params.cell_size = cell_size;
+		sweep.push_back(params);
+	}
+	for (int icon_paths : {0, 100, 1000}) {
+		SyntheticParams params = base;
+		params.name = "icon-paths-" + std::to_string(icon_paths);
+		params.icon_paths = icon_paths;
+		sweep.push_back(params);
+	}
+	for (config::OutputType output_type :
+			{config::OutputType::PDF, config::OutputType::PNG}) {
+		SyntheticParams params = base;
+		params.name = "output-" + config::OutputType_Name(output_type);
+		params.output_type = output_type;
+		sweep.push_back(params);
+	}
+	return sweep;
+}
+
+// Renders conf, discarding the output, and returns its size in bytes, or
+// -1 on failure.
+long long render(const config::CalendarConfig& conf) {
+	auto console = spdlog::stderr_logger_mt("bench_render");
+	console->set_level(spdlog::level::warn);
+	RenderContext *ctx = create_render_context(conf, console);
+	if (ctx == NULL) {
+		return -1;
+	}
+	long long bytes = 0;
+	bool ok = render_calendar(ctx, [&](config::OutputType output_type,
+				const unsigned char *data, size_t length) {
+		bytes += length;
+		return true;
+	});
+	free_render_context(ctx);
+	return ok ? bytes : -1;
+}
+
+// Renders conf in a child process, so that its peak RSS is its own.
+bool bench(const std::string& name, const config::CalendarConfig& conf) {
+	int fds[2];
+	if (pipe(fds) < 0) {
+		perror("pipe");
+		return false;
+	}
+	auto start = std::chrono::steady_clock::now();
+	pid_t pid = fork();
+	if (pid < 0) {
+		perror("fork");
+		return false;
+	}
+	if (pid == 0) {
+		close(fds[0]);
+		long long bytes = render(conf);
+		bool written = write(fds[1], &bytes, sizeof(bytes)) == sizeof(bytes);
+		_exit(written ? EXIT_SUCCESS : EXIT_FAILURE);
+	}
+	close(fds[1]);
+	long long bytes = -1;
+	if (read(fds[0], &bytes, sizeof(bytes)) != sizeof(bytes)) {
+		bytes = -1;
+	}
+	close(fds[0]);
+	int status;
+	struct rusage usage;
+	while (wait4(pid, &status, 0, &usage) < 0 && errno == EINTR) {
+	}
+	std::chrono::duration<double, std::milli> elapsed =
+		std::chrono::steady_clock::now() - start;
+
+	if (bytes < 0) {
+		printf("%-24s %12s\n", name.c_str(), "failed");
+		return false;
+	}
+	printf("%-24s %12.1f %12.1f %14lld\n", name.c_str(), elapsed.count(),
+			usage.ru_maxrss / 1024.0, bytes);
+	fflush(stdout);
+	return true;
+}
+
+bool read_config(const std::string& filename, config::CalendarConfig *conf) {
+	std::ifstream in(filename);
+	std::stringstream text;
+	text << in.rdbuf();
+	if (!in) {
+		fprintf(stderr, "%s: %s\n", filename.c_str(), strerror(errno));
+		return false;
+	}
+	return google::protobuf::TextFormat::ParseFromString(text.str(), conf);
+}
+
+bool write_configs(const std::string& dir) {
+	for (const SyntheticParams& params : get_sweep()) {
+		std::string text;
+		google::protobuf::TextFormat::PrintToString(make_config(params), &text);
+		std::string filename = dir + "/" + params.name + ".txt";
+		std::ofstream out(filename);
+		out << text;
+		if (!out) {
+			fprintf(stderr, "%s: %s\n", filename.c_str(), strerror(errno));
+			return false;
+		}
+	}
+	return true;
+}
+
+int main(int argc, char *argv[])
+{
+	if (argc == 3 && strcmp(argv[1], "--write-configs") == 0) {
+		return write_configs(argv[2]) ? EXIT_SUCCESS : EXIT_FAILURE;
+	}
+
+	printf("%-24s %12s %12s %14s\n", "config", "wall ms", "peak RSS MB",
+			"output bytes");
+	bool ok = true;
+	if (argc > 1) {
+		for (int i = 1; i < argc; i++) {
+			config::CalendarConfig conf;
+			ok = read_config(argv[i], &conf) && bench(argv[i], conf) && ok;
+		}
+	} else {
+		for (const SyntheticParams& params : get_sweep()) {
+			ok = bench(params.name, make_config(params)) && ok;
+		}
+	}
+	return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
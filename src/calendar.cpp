@@ -0,0 +1,1605 @@
+#include <cairo.h>
+#include <cairo-pdf.h>
+#include <cairo-svg.h>
+#include <librsvg/rsvg.h>
+#include <math.h>
+#include <pango/pangocairo.h>
+#include <png.h>
+#include <setjmp.h>
+#include <spdlog/spdlog.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+
+#include "calendar.h"
+#include "date.h"
+#include "holidays.h"
+#include "profile.h"
+#include "special_days.h"
+#include "svg_defs.h"
+#include "config.pb.h"
+
+namespace {
+
+const int days_per_months[] = {
+	31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31 + 6};
+
+// Limits on configs, which may come from daemon clients.
+const int max_num_years = 1000;
+// Years are labeled with at most four digits.
+const int max_year = 9999;
+const int max_render_threads = 64;
+// Cairo's limit on the width and height of an image surface, in pixels.
+const double max_surface_size = 32767;
+
+// Icons are drawn as alpha masks filled with the current source color, so
+// the SVG's own colors are ignored.
+struct Icon {
+	// Icon rendered at get_icon_size(): an image surface for raster
+	// output, a recording surface otherwise.
+	cairo_surface_t *mask;
+};
+
+struct GlyphRun {
+	cairo_scaled_font_t *font;
+	// Positioned relative to the top-left corner of the layout.
+	std::vector<cairo_glyph_t> glyphs;
+};
+
+// Glyphs of a short label shaped once by Pango, to be replayed with
+// cairo_show_glyphs().
+struct ShapedText {
+	std::vector<GlyphRun> runs;
+	// Logical size, as reported by pango_layout_get_size().
+	double width;
+	double height;
+	// Set if Pango could not map every character to a glyph. Such text is
+	// drawn through its own layout so that Pango renders its hex boxes.
+	PangoLayout *fallback_layout;
+};
+
+struct PageLayout {
+	int this_year;
+	double offset_width;
+	double visible_left;
+	double visible_width;
+	double print_width;
+	int surface_height;
+	// Where the calendar's origin lies on the output.
+	double origin_x;
+	// Threads drawing the year rows; more than one only for raster output.
+	int num_threads;
+};
+
+}  // namespace
+
+// Weekday of January 1, leap year, row parity, raster, the config the
+// template is drawn from: cell size, cell margin, month label height, year
+// label width, font size, number font family and the visible columns, and
+// the template's offset within a pixel.
+typedef std::tuple<int, bool, int, bool, double, double, double, double,
+		double, std::string, int, int, double, double> YearTemplateKey;
+
+// Pango layouts, shaped labels, icons and year templates, which only depend
+// on their keys and so can be reused by later renders. Entries made for
+// raster output are kept apart, since hinting, icon masks and templates
+// differ between image and vector surfaces.
+struct RenderCache {
+	// Keyed by (SVG, icon size, raster).
+	std::map<std::tuple<std::string, double, bool>, Icon> icons;
+	// Keyed by (font family, font size, weight, raster).
+	std::map<std::tuple<std::string, double, PangoWeight, bool>, PangoLayout*>
+		layouts;
+	// Keyed by (font family, font size, weight, raster, text).
+	std::map<std::tuple<std::string, double, PangoWeight, bool, std::string>,
+		ShapedText> shaped_texts;
+	// Keyed by get_year_template_key().
+	std::map<YearTemplateKey, cairo_surface_t*> year_templates;
+};
+
+// Everything one calendar render reads or caches.
+struct RenderContext {
+	config::CalendarConfig conf;
+	std::shared_ptr<spdlog::logger> console;
+
+	std::vector<config::OutputType> output_types;
+	// Set when PNG is the only output, so drawing need not stay vector.
+	bool raster_output;
+	PageLayout page;
+
+	// Day columns [first_visible_column, last_visible_column) are the only
+	// ones that end up in the output.
+	int first_visible_column;
+	int last_visible_column;
+	bool year_labels_visible;
+	double month_label_x[12];
+
+	SpecialDayIndex special_days;
+	HolidayTable holidays;
+
+	// Icons of special days, owned by cache.
+	std::unordered_map<const config::SpecialDay*, const Icon*> icons;
+	RenderCache *cache;
+	// Set if cache was created for this context alone.
+	bool owns_cache;
+	// Where phases are timed, if anywhere.
+	Profile *profile;
+};
+
+namespace {
+
+// The first special day of the date, unless a later one is on an
+// every-tenth year.
+const config::SpecialDay* get_special_day(RenderContext *ctx,
+		const Date& date) {
+	int index = ctx->special_days.find(date);
+	return index >= 0 ? &ctx->conf.special_day(index) : nullptr;
+}
+
+void count_op(RenderContext *ctx, Counter counter, long n = 1) {
+	if (ctx->profile != NULL) {
+		ctx->profile->count(counter, n);
+	}
+}
+
+PangoLayout* init_pango_layout(cairo_t *cr, const std::string& font_family,
+		double font_size, PangoWeight weight) {
+	PangoLayout *layout = pango_cairo_create_layout(cr);
+	PangoFontDescription *desc =
+		pango_font_description_from_string(font_family.c_str());
+	pango_font_description_set_weight(desc, weight);
+	pango_font_description_set_absolute_size(desc, font_size * PANGO_SCALE);
+	pango_layout_set_font_description (layout, desc);
+	pango_font_description_free(desc);
+	return layout;
+}
+
+// Returns a layout shared by every label of the same style. Callers only
+// set its text, and must not unref it.
+PangoLayout* get_pango_layout(RenderContext *ctx, cairo_t *cr,
+		const std::string& font_family, double font_size, PangoWeight weight) {
+	auto key = std::make_tuple(font_family, font_size, weight,
+			ctx->raster_output);
+	auto it = ctx->cache->layouts.find(key);
+	if (it != ctx->cache->layouts.end()) {
+		return it->second;
+	}
+	PangoLayout *layout = init_pango_layout(cr, font_family, font_size, weight);
+	count_op(ctx, COUNTER_LAYOUTS_CREATED);
+	ctx->cache->layouts[key] = layout;
+	return layout;
+}
+
+void free_pango_layouts(RenderCache *cache) {
+	for (auto& entry : cache->layouts) {
+		g_object_unref(entry.second);
+	}
+	cache->layouts.clear();
+}
+
+void shape_text(PangoLayout *layout, ShapedText *shaped) {
+	int width, height;
+	pango_layout_get_size(layout, &width, &height);
+	shaped->width = (double)width / PANGO_SCALE;
+	shaped->height = (double)height / PANGO_SCALE;
+	shaped->fallback_layout = NULL;
+
+	double baseline = (double)pango_layout_get_baseline(layout) / PANGO_SCALE;
+	double x = 0;
+	PangoLayoutLine *line = pango_layout_get_line_readonly(layout, 0);
+	for (GSList *l = line != NULL ? line->runs : NULL; l != NULL; l = l->next) {
+		PangoLayoutRun *run = static_cast<PangoLayoutRun*>(l->data);
+		GlyphRun glyph_run;
+		glyph_run.font = cairo_scaled_font_reference(
+				pango_cairo_font_get_scaled_font(
+					(PangoCairoFont*)run->item->analysis.font));
+
+		for (int i = 0; i < run->glyphs->num_glyphs; i++) {
+			const PangoGlyphInfo& info = run->glyphs->glyphs[i];
+			if (info.glyph & PANGO_GLYPH_UNKNOWN_FLAG) {
+				if (shaped->fallback_layout == NULL) {
+					shaped->fallback_layout = pango_layout_copy(layout);
+				}
+			} else if (info.glyph != PANGO_GLYPH_EMPTY) {
+				cairo_glyph_t glyph;
+				glyph.index = info.glyph;
+				glyph.x = x + (double)info.geometry.x_offset / PANGO_SCALE;
+				glyph.y = baseline + (double)info.geometry.y_offset / PANGO_SCALE;
+				glyph_run.glyphs.push_back(glyph);
+			}
+			x += (double)info.geometry.width / PANGO_SCALE;
+		}
+		shaped->runs.push_back(glyph_run);
+	}
+	if (shaped->fallback_layout != NULL) {
+		// Lays the copy out and fills the font's hex box caches, so that
+		// drawing it later only reads them.
+		cairo_surface_t *surface =
+			cairo_image_surface_create(CAIRO_FORMAT_A8, 1, 1);
+		cairo_t *cr = cairo_create(surface);
+		pango_cairo_show_layout(cr, shaped->fallback_layout);
+		cairo_destroy(cr);
+		cairo_surface_destroy(surface);
+	}
+}
+
+const ShapedText& get_shaped_text(RenderContext *ctx, cairo_t *cr,
+		const std::string& font_family, double font_size, PangoWeight weight,
+		const char* text) {
+	auto key = std::make_tuple(font_family, font_size, weight,
+			ctx->raster_output, std::string(text));
+	auto it = ctx->cache->shaped_texts.find(key);
+	if (it != ctx->cache->shaped_texts.end()) {
+		return it->second;
+	}
+	PangoLayout *layout =
+		get_pango_layout(ctx, cr, font_family, font_size, weight);
+	pango_layout_set_text(layout, text, -1);
+	ShapedText& shaped = ctx->cache->shaped_texts[key];
+	shape_text(layout, &shaped);
+	count_op(ctx, COUNTER_TEXTS_SHAPED);
+	for (const GlyphRun& run : shaped.runs) {
+		count_op(ctx, COUNTER_GLYPHS_SHAPED, run.glyphs.size());
+	}
+	return shaped;
+}
+
+// Draws the text with its top-left corner at the current point.
+void show_shaped_text(RenderContext *ctx, cairo_t *cr,
+		const ShapedText& shaped) {
+	if (shaped.fallback_layout != NULL) {
+		pango_cairo_show_layout(cr, shaped.fallback_layout);
+		count_op(ctx, COUNTER_LAYOUTS_SHOWN);
+		return;
+	}
+	double x, y;
+	cairo_get_current_point(cr, &x, &y);
+	cairo_save(cr);
+	cairo_translate(cr, x, y);
+	for (const GlyphRun& run : shaped.runs) {
+		cairo_set_scaled_font(cr, run.font);
+		cairo_show_glyphs(cr, run.glyphs.data(), run.glyphs.size());
+	}
+	count_op(ctx, COUNTER_GLYPH_RUNS_SHOWN, shaped.runs.size());
+	cairo_restore(cr);
+}
+
+void free_shaped_texts(RenderCache *cache) {
+	for (auto& entry : cache->shaped_texts) {
+		for (GlyphRun& run : entry.second.runs) {
+			cairo_scaled_font_destroy(run.font);
+		}
+		if (entry.second.fallback_layout != NULL) {
+			g_object_unref(entry.second.fallback_layout);
+		}
+	}
+	cache->shaped_texts.clear();
+}
+
+void draw_text_of_year(RenderContext *ctx, cairo_t *cr, int y,
+		const char* text, PangoWeight weight) {
+	const config::CalendarConfig& conf = ctx->conf;
+	PangoLayout *layout = get_pango_layout(ctx, cr, conf.number_font_family(),
+			conf.font_size(), weight);
+	pango_layout_set_text(layout, text, -1);
+
+	int width, height;
+	pango_layout_get_size(layout, &width, &height);
+	cairo_move_to(cr,
+			(conf.year_label_width() - ((double)width / PANGO_SCALE)) / 2,
+			(y + 1) * (conf.cell_size() + conf.cell_margin()) +
+			(conf.cell_size() - ((double)height / PANGO_SCALE)) / 2 +
+			conf.month_label_height());
+
+	pango_cairo_show_layout(cr, layout);
+	count_op(ctx, COUNTER_LAYOUTS_SHOWN);
+}
+
+double get_day_x(RenderContext *ctx, int day_index) {
+	const config::CalendarConfig& conf = ctx->conf;
+	return day_index * (conf.cell_size() + conf.cell_margin()) +
+		conf.year_label_width();
+}
+
+double get_day_y(RenderContext *ctx, int year_index) {
+	const config::CalendarConfig& conf = ctx->conf;
+	return year_index * (conf.cell_size() + conf.cell_margin()) +
+		conf.month_label_height();
+}
+
+RsvgHandle* parse_svg(RenderContext *ctx, const std::string& svg) {
+	ScopedTimer timer(ctx->profile, "parse_svg");
+	GError *error = NULL;
+	RsvgHandle *handle = rsvg_handle_new_from_data(
+			reinterpret_cast<const guint8*>(svg.c_str()),
+			svg.length(), &error);
+	count_op(ctx, COUNTER_SVGS_PARSED);
+	if (handle == NULL) {
+		ctx->console->error(error->message);
+		g_error_free(error);
+	}
+	return handle;
+}
+
+double get_icon_size(RenderContext *ctx) {
+	const config::CalendarConfig& conf = ctx->conf;
+	return conf.cell_size() - 6;
+}
+
+void scale_icon(RenderContext *ctx, cairo_t *cr, RsvgHandle *handle) {
+	RsvgDimensionData dimensions;
+	rsvg_handle_get_dimensions(handle, &dimensions);
+
+	double dst_size = get_icon_size(ctx);
+	double scale_factor =
+		std::min(dst_size / dimensions.width, dst_size / dimensions.height);
+	cairo_scale(cr, scale_factor, scale_factor);
+}
+
+cairo_surface_t* create_icon_mask(RenderContext *ctx, RsvgHandle *handle) {
+	ScopedTimer timer(ctx->profile, "render_svg");
+	double size = get_icon_size(ctx);
+	cairo_surface_t *mask;
+	if (ctx->raster_output) {
+		int pixels = ceil(size);
+		mask = cairo_image_surface_create(CAIRO_FORMAT_A8, pixels, pixels);
+	} else {
+		cairo_rectangle_t extents = {0, 0, size, size};
+		mask = cairo_recording_surface_create(CAIRO_CONTENT_ALPHA, &extents);
+	}
+	cairo_t *cr = cairo_create(mask);
+	scale_icon(ctx, cr, handle);
+	rsvg_handle_render_cairo(handle, cr);
+	count_op(ctx, COUNTER_SVGS_RENDERED);
+	cairo_destroy(cr);
+	return mask;
+}
+
+bool load_icons(RenderContext *ctx) {
+	const config::CalendarConfig& conf = ctx->conf;
+	for (int i = 0; i < conf.special_day_size(); i++) {
+		const config::SpecialDay& d = conf.special_day(i);
+		if (!d.has_svg()) {
+			continue;
+		}
+		auto key = std::make_tuple(d.svg(), get_icon_size(ctx),
+				ctx->raster_output);
+		auto it = ctx->cache->icons.find(key);
+		if (it == ctx->cache->icons.end()) {
+			RsvgHandle *handle = parse_svg(ctx, d.svg());
+			if (handle == NULL) {
+				return false;
+			}
+			// The parsed SVG is not needed once the mask is drawn.
+			Icon icon = {create_icon_mask(ctx, handle)};
+			g_object_unref(handle);
+			it = ctx->cache->icons.emplace(key, icon).first;
+		}
+		ctx->icons[&d] = &it->second;
+	}
+	return true;
+}
+
+void free_icons(RenderCache *cache) {
+	for (auto& entry : cache->icons) {
+		if (entry.second.mask != NULL) {
+			cairo_surface_destroy(entry.second.mask);
+		}
+	}
+	cache->icons.clear();
+}
+
+// Fills the icon's shape with the current source.
+void render_icon(RenderContext *ctx, const Icon& icon, cairo_t *cr,
+		int x, int y)
+{
+	cairo_save(cr);
+
+	cairo_translate(cr, get_day_x(ctx, x) + 3, get_day_y(ctx, y) + 3);
+
+	cairo_mask_surface(cr, icon.mask, 0, 0);
+	count_op(ctx, COUNTER_MASKS);
+
+	cairo_restore(cr);
+}
+
+double draw_text_of_month(RenderContext *ctx, cairo_t *cr, double x,
+		const char* text) {
+	const config::CalendarConfig& conf = ctx->conf;
+	PangoLayout *layout = get_pango_layout(ctx, cr, conf.header_font_family(),
+			conf.bigger_font_size(), PANGO_WEIGHT_SEMIBOLD);
+	pango_layout_set_text(layout, text, -1);
+
+	int width, height;
+	pango_layout_get_size(layout, &width, &height);
+
+	cairo_move_to(cr, x,
+			(conf.month_label_height() - ((double)height / PANGO_SCALE) +
+			 conf.cell_margin()) / 2);
+	pango_cairo_show_layout(cr, layout);
+	count_op(ctx, COUNTER_LAYOUTS_SHOWN);
+	return x + width / PANGO_SCALE;
+}
+
+double get_text_of_day_x(RenderContext *ctx, int x, double text_width) {
+	const config::CalendarConfig& conf = ctx->conf;
+	return x * (conf.cell_size() + conf.cell_margin()) +
+			(conf.cell_size() - text_width) / 2 +
+			conf.year_label_width();
+}
+
+void draw_text_of_day(RenderContext *ctx, cairo_t *cr, int x, int y,
+		const char* text, const std::string& font_family, PangoWeight weight) {
+	const config::CalendarConfig& conf = ctx->conf;
+	const ShapedText& shaped =
+		get_shaped_text(ctx, cr, font_family, conf.font_size(), weight, text);
+
+	double text_x = get_text_of_day_x(ctx, x, shaped.width);
+	cairo_move_to(cr,
+			text_x,
+			y * (conf.cell_size() + conf.cell_margin()) +
+			(conf.cell_size() - shaped.height) / 2 +
+			conf.month_label_height());
+	show_shaped_text(ctx, cr, shaped);
+	cairo_new_path(cr);
+}
+
+void draw_text_on_bottom_left(RenderContext *ctx, cairo_t *cr) {
+	const config::CalendarConfig& conf = ctx->conf;
+	PangoLayout *layout = get_pango_layout(ctx, cr, conf.quote_font_family(),
+			conf.font_size(), PANGO_WEIGHT_NORMAL);
+	pango_layout_set_text(layout, conf.bottom_left_label().c_str(), -1);
+
+	int width, height;
+	pango_layout_get_size(layout, &width, &height);
+	cairo_move_to(cr,
+			conf.year_label_width(),
+			(conf.num_years() + 1) * (conf.cell_size() + conf.cell_margin()) +
+			(conf.cell_size() - ((double)height / PANGO_SCALE)) / 2 +
+			conf.month_label_height());
+	pango_cairo_show_layout(cr, layout);
+	count_op(ctx, COUNTER_LAYOUTS_SHOWN);
+}
+
+void draw_text_on_bottom_right(RenderContext *ctx, cairo_t *cr) {
+	const config::CalendarConfig& conf = ctx->conf;
+	PangoLayout *layout = get_pango_layout(ctx, cr, conf.quote_font_family(),
+			conf.font_size(), PANGO_WEIGHT_NORMAL);
+	pango_layout_set_text(layout, conf.bottom_right_label().c_str(), -1);
+
+	int width, height;
+	pango_layout_get_size(layout, &width, &height);
+	cairo_move_to(cr,
+			(366 + 5) * (conf.cell_size() + conf.cell_margin()) -
+			conf.cell_margin() * 2 +
+			conf.year_label_width() - ((double)width / PANGO_SCALE),
+			(conf.num_years() + 1) * (conf.cell_size() + conf.cell_margin()) +
+			(conf.cell_size() - ((double)height / PANGO_SCALE)) / 2 +
+			conf.month_label_height());
+	pango_cairo_show_layout(cr, layout);
+	count_op(ctx, COUNTER_LAYOUTS_SHOWN);
+}
+
+void draw_symbol_of_day(RenderContext *ctx, cairo_t *cr, int day_index,
+		int year_index, int month) {
+	const config::CalendarConfig& conf = ctx->conf;
+	double x = get_day_x(ctx, day_index) + conf.cell_size() / 2;
+	double y = get_day_y(ctx, year_index) + conf.cell_size() / 2;
+
+	if ((year_index + month) % 2) {
+		double size = 1.5;
+		cairo_set_line_width(cr, 0.5);
+		cairo_move_to(cr, x - size, y - size);
+		cairo_line_to(cr, x + size, y + size);
+		cairo_move_to(cr, x + size, y - size);
+		cairo_line_to(cr, x - size, y + size);
+		cairo_stroke(cr);
+		count_op(ctx, COUNTER_PATH_OPS, 4);
+		count_op(ctx, COUNTER_STROKES);
+	} else {
+		cairo_move_to(cr, x, y);
+		cairo_arc(cr, x, y, 1, 0, 2*M_PI);
+		cairo_fill(cr);
+		count_op(ctx, COUNTER_PATH_OPS, 2);
+		count_op(ctx, COUNTER_FILLS);
+	}
+}
+
+void draw_rectangle_of_day(RenderContext *ctx, cairo_t *cr, int day_index,
+		int year_index) {
+	const config::CalendarConfig& conf = ctx->conf;
+	double x = get_day_x(ctx, day_index);
+	double y = get_day_y(ctx, year_index);
+	double size = conf.cell_size();
+	double r = conf.cell_size() / 8;
+	double degrees = M_PI / 180.0;
+
+	cairo_new_sub_path(cr);
+	cairo_arc(cr, x + size - r, y + r, r, -90 * degrees, 0 * degrees);
+	cairo_arc(cr, x + size - r, y + size - r, r, 0 * degrees, 90 * degrees);
+	cairo_arc(cr, x + r, y + size - r, r, 90 * degrees, 180 * degrees);
+	cairo_arc(cr, x + r, y + r, r, 180 * degrees, 270 * degrees);
+	cairo_close_path(cr);
+	count_op(ctx, COUNTER_PATH_OPS, 6);
+}
+
+double cairo_color(int color) {
+	return (double) color / 255;
+}
+
+
+void set_rgb(cairo_t *cr, const config::RGB& rgb) {
+	cairo_set_source_rgb(cr, cairo_color(rgb.red()),
+			cairo_color(rgb.green()), cairo_color(rgb.blue()));
+}
+
+
+void year_label(RenderContext *ctx, cairo_t *cr, int this_year,
+		int first_row, int last_row) {
+	const config::CalendarConfig& conf = ctx->conf;
+	char buf[16];
+
+	if (!ctx->year_labels_visible) {
+		return;
+	}
+	for (int i = first_row; i < last_row; i++) {
+		int year = this_year + i;
+		snprintf(buf, sizeof(buf), "%d", year);
+		if (year % 5) {
+			set_rgb(cr, conf.rgb_header());
+			draw_text_of_year(ctx, cr, i, buf, PANGO_WEIGHT_NORMAL);
+		} else {
+			cairo_set_source_rgb(cr, 0, 0, 0);
+			draw_text_of_year(ctx, cr, i, buf, PANGO_WEIGHT_SEMIBOLD);
+		}
+	}
+}
+
+void month_label(RenderContext *ctx, cairo_t *cr) {
+	const config::CalendarConfig& conf = ctx->conf;
+	const char *month_text[] = {
+		"JANUARY", "FEBRUARY", "MARCH", "APRIL", "MAY", "JUNE", "JULY",
+		"AUGUST", "SEPTEMBER", "OCTOBER", "NOVEMBER", "DECEMBER"};
+
+	int d = 0;
+	double month_line_y = (conf.month_label_height() + conf.cell_margin()) / 2;
+	for (int m = 0; m < 12; m++) {
+		int first_d = d;
+		d += days_per_months[m];
+		if (d <= ctx->first_visible_column ||
+				ctx->last_visible_column <= first_d) {
+			continue;
+		}
+
+		set_rgb(cr, conf.rgb_header());
+		double end_of_label =
+			draw_text_of_month(ctx, cr, ctx->month_label_x[m], month_text[m]);
+
+		cairo_set_line_width(cr, 1);
+		set_rgb(cr, conf.rgb_month_line());
+		cairo_move_to(cr,
+				end_of_label + conf.cell_size() / 2,
+				month_line_y);
+		cairo_line_to(cr,
+				get_day_x(ctx, d) -
+				(m < 11 ? conf.cell_size() : conf.cell_margin()),
+				month_line_y);
+		cairo_stroke(cr);
+		count_op(ctx, COUNTER_PATH_OPS, 2);
+		count_op(ctx, COUNTER_STROKES);
+	}
+}
+
+void wday_label(RenderContext *ctx, cairo_t *cr) {
+	const config::CalendarConfig& conf = ctx->conf;
+	const char *wday_text[] = {"M", "T", "W", "Th", "F", "S", "Su"};
+	const PangoWeight wday_weight[] = {
+		PANGO_WEIGHT_NORMAL, PANGO_WEIGHT_NORMAL, PANGO_WEIGHT_NORMAL,
+		PANGO_WEIGHT_NORMAL, PANGO_WEIGHT_NORMAL, PANGO_WEIGHT_NORMAL,
+		PANGO_WEIGHT_SEMIBOLD};
+
+	// Month labels start above the first weekday label of each month,
+	// visible or not.
+	int d = 0;
+	for (int m = 0; m < 12; m++) {
+		int wday_index = d % 7;
+		const ShapedText& shaped = get_shaped_text(ctx, cr,
+				conf.header_font_family(), conf.font_size(),
+				wday_weight[wday_index], wday_text[wday_index]);
+		ctx->month_label_x[m] = get_text_of_day_x(ctx, d, shaped.width);
+		d += days_per_months[m];
+	}
+
+	for (d = ctx->first_visible_column;
+			d < std::min(ctx->last_visible_column, 365 + 6); d++) {
+		int wday_index = d % 7;
+		if (wday_index == 6) {
+			set_rgb(cr, conf.rgb_header_sunday());
+		} else {
+			set_rgb(cr, conf.rgb_header());
+		}
+		draw_text_of_day(ctx, cr, d, 0, wday_text[wday_index],
+				conf.header_font_family(), wday_weight[wday_index]);
+	}
+}
+
+bool is_column_visible(RenderContext *ctx, int day_index) {
+	return ctx->first_visible_column <= day_index &&
+		day_index < ctx->last_visible_column;
+}
+
+int get_wday_index(int wday) {
+	if (wday == 0) {
+		return 6;
+	}
+	return wday - 1;
+}
+
+// Calls f(day_index, date, yday, wday) for every day of the year.
+template <typename F>
+void for_each_day_index(int year, F f) {
+	int first_index = get_wday_index(
+			weekday_from_days(days_from_civil(year, 1, 1)));
+	for_each_day(year, [&](const Date& date, int yday, int wday) {
+		f(first_index + yday, date, yday, wday);
+	});
+}
+
+double get_year_template_x(RenderContext *ctx) {
+	return get_day_x(ctx, ctx->first_visible_column);
+}
+
+double get_year_template_width(RenderContext *ctx) {
+	return get_day_x(ctx, ctx->last_visible_column) - get_year_template_x(ctx);
+}
+
+// Rounded to 1/64 of a pixel, so that a few templates cover every row.
+double get_pixel_fraction(double x) {
+	return round((x - floor(x)) * 64) / 64;
+}
+
+// How far past a whole pixel the year template of row lies on raster
+// output, which is only ever translated by page.origin_x and whole pixels.
+// Raster templates are drawn that far into their image, and painted from
+// a whole pixel, so that rows are not resampled.
+double get_year_template_dx(RenderContext *ctx) {
+	if (!ctx->raster_output) {
+		return 0;
+	}
+	return get_pixel_fraction(ctx->page.origin_x + get_year_template_x(ctx));
+}
+
+double get_year_template_dy(RenderContext *ctx, int row) {
+	if (!ctx->raster_output) {
+		return 0;
+	}
+	return get_pixel_fraction(get_day_y(ctx, row));
+}
+
+// Draws the part of a year row that only depends on the weekday of January
+// 1, leap years and the parity of the row: Sunday numbers, and dots and
+// crosses on the other days.
+void draw_year_template(RenderContext *ctx, cairo_t *cr, int year, int row) {
+	const config::CalendarConfig& conf = ctx->conf;
+	char buf[4];
+	cairo_set_source_rgb(cr, 0, 0, 0);
+	for_each_day_index(year, [&](int i, const Date& date, int yday, int wday) {
+		if (!is_column_visible(ctx, i)) {
+			return;
+		} else if (wday == 0) {
+			snprintf(buf, sizeof(buf), "%d", date.day);
+			draw_text_of_day(ctx, cr, i, row, buf,
+					conf.number_font_family(), PANGO_WEIGHT_SEMIBOLD);
+		} else {
+			draw_symbol_of_day(ctx, cr, i, row, date.month - 1);
+		}
+	});
+}
+
+// Year templates are kept for the whole render, so tiled PNG output, whose
+// memory should only depend on its tile, draws them into each row instead.
+bool uses_year_templates(RenderContext *ctx) {
+	return !ctx->raster_output || ctx->conf.tile_height() <= 0;
+}
+
+// Draws the year template of row into an image for raster output, and
+// into a recording surface otherwise, so that it can be replayed on any
+// target.
+cairo_surface_t* create_year_template(RenderContext *ctx, int year, int row) {
+	const config::CalendarConfig& conf = ctx->conf;
+	double dx = get_year_template_dx(ctx);
+	double dy = get_year_template_dy(ctx, row);
+	double width = ceil(get_year_template_width(ctx) + dx);
+	double height = ceil(conf.cell_size() + dy);
+	cairo_surface_t *surface;
+	if (ctx->raster_output) {
+		surface = cairo_image_surface_create(CAIRO_FORMAT_ARGB32,
+				width, height);
+	} else {
+		cairo_rectangle_t extents = {0, 0, width, height};
+		surface = cairo_recording_surface_create(CAIRO_CONTENT_COLOR_ALPHA,
+				&extents);
+	}
+	cairo_t *template_cr = cairo_create(surface);
+	cairo_translate(template_cr, dx - get_year_template_x(ctx),
+			dy - get_day_y(ctx, row));
+	draw_year_template(ctx, template_cr, year, row);
+	cairo_destroy(template_cr);
+	return surface;
+}
+
+YearTemplateKey get_year_template_key(RenderContext *ctx, int year,
+		int row) {
+	const config::CalendarConfig& conf = ctx->conf;
+	return std::make_tuple(weekday_from_days(days_from_civil(year, 1, 1)),
+			is_leap_year(year), row % 2, ctx->raster_output,
+			conf.cell_size(), conf.cell_margin(), conf.month_label_height(),
+			conf.year_label_width(), conf.font_size(),
+			conf.number_font_family(), ctx->first_visible_column,
+			ctx->last_visible_column, get_year_template_dx(ctx),
+			get_year_template_dy(ctx, row));
+}
+
+cairo_surface_t* get_year_template(RenderContext *ctx, int year, int row) {
+	YearTemplateKey key = get_year_template_key(ctx, year, row);
+	auto it = ctx->cache->year_templates.find(key);
+	if (it != ctx->cache->year_templates.end()) {
+		return it->second;
+	}
+	cairo_surface_t *surface = create_year_template(ctx, year, row);
+	ctx->cache->year_templates[key] = surface;
+	return surface;
+}
+
+void free_year_templates(RenderCache *cache) {
+	for (auto& entry : cache->year_templates) {
+		cairo_surface_destroy(entry.second);
+	}
+	cache->year_templates.clear();
+}
+
+struct DayOverlay {
+	int day_index;
+	Date date;
+	// NULL for holidays.
+	const config::SpecialDay* special_day;
+};
+
+void year(RenderContext *ctx, cairo_t *cr, int y, int year) {
+	const config::CalendarConfig& conf = ctx->conf;
+	char buf[4];
+	int row = y + 1;
+	if (ctx->first_visible_column >= ctx->last_visible_column) {
+		return;
+	}
+	const HolidayMask& holiday_mask = ctx->holidays.get_mask(year);
+
+	// Days that do not look like the template
+	std::vector<DayOverlay> overlays;
+	for_each_day_index(year, [&](int i, const Date& date, int yday, int wday) {
+		if (!is_column_visible(ctx, i)) {
+			return;
+		}
+		const config::SpecialDay* special_day = get_special_day(ctx, date);
+		if (special_day != nullptr ||
+				(wday != 0 && holiday_mask.test(yday))) {
+			overlays.push_back(DayOverlay{i, date, special_day});
+		}
+	});
+
+	cairo_save(cr);
+	cairo_rectangle(cr, get_year_template_x(ctx), get_day_y(ctx, row),
+			get_year_template_width(ctx), conf.cell_size());
+	for (const DayOverlay& overlay : overlays) {
+		cairo_rectangle(cr, get_day_x(ctx, overlay.day_index),
+				get_day_y(ctx, row), conf.cell_size(), conf.cell_size());
+	}
+	cairo_set_fill_rule(cr, CAIRO_FILL_RULE_EVEN_ODD);
+	cairo_clip(cr);
+	count_op(ctx, COUNTER_PATH_OPS, 1 + overlays.size());
+	if (uses_year_templates(ctx)) {
+		cairo_set_source_surface(cr, get_year_template(ctx, year, row),
+				get_year_template_x(ctx) - get_year_template_dx(ctx),
+				get_day_y(ctx, row) - get_year_template_dy(ctx, row));
+		if (ctx->raster_output) {
+			// Lands on whole pixels, up to the rounding of the offset.
+			cairo_pattern_set_filter(cairo_get_source(cr),
+					CAIRO_FILTER_NEAREST);
+		}
+		cairo_paint(cr);
+		count_op(ctx, COUNTER_PAINTS);
+	} else {
+		draw_year_template(ctx, cr, year, row);
+	}
+	cairo_restore(cr);
+
+	for (const DayOverlay& overlay : overlays) {
+		int i = overlay.day_index;
+		const config::SpecialDay* special_day = overlay.special_day;
+		if (special_day != nullptr) {
+			if (special_day->has_year() || (
+						special_day->has_first_year() &&
+						is_every_tenth_year(special_day->first_year(),
+							overlay.date.year))) {
+				draw_rectangle_of_day(ctx, cr, i, row);
+				if (special_day->has_rgb()) {
+					set_rgb(cr, special_day->rgb());
+				} else {
+					set_rgb(cr, conf.rgb_holiday());
+				}
+				cairo_fill(cr);
+				count_op(ctx, COUNTER_FILLS);
+
+				cairo_set_source_rgb(cr, 1, 1, 1);
+			} else {
+				cairo_set_source_rgb(cr, 0, 0, 0);
+			}
+			auto icon = ctx->icons.find(special_day);
+			if (icon != ctx->icons.end()) {
+				render_icon(ctx, *icon->second, cr, i, row);
+			}
+		} else {
+			draw_rectangle_of_day(ctx, cr, i, row);
+			set_rgb(cr, conf.rgb_holiday());
+			cairo_fill(cr);
+			count_op(ctx, COUNTER_FILLS);
+
+			cairo_set_source_rgb(cr, 1, 1, 1);
+			snprintf(buf, sizeof(buf), "%d", overlay.date.day);
+			draw_text_of_day(ctx, cr, i, row, buf, conf.number_font_family(),
+					PANGO_WEIGHT_SEMIBOLD);
+		}
+	}
+}
+
+// Rejects configs that would draw outside the month tables, make surfaces
+// larger than cairo allows or start more threads than is reasonable.
+bool check_config(RenderContext *ctx) {
+	const config::CalendarConfig& conf = ctx->conf;
+	if (conf.first_month() < 1 || conf.num_months() < 1 ||
+			conf.first_month() + conf.num_months() - 1 > 12) {
+		ctx->console->error("Invalid months: {} + {}", conf.first_month(),
+				conf.num_months());
+		return false;
+	}
+	if (conf.num_years() < 1 || conf.num_years() > max_num_years) {
+		ctx->console->error("Invalid num_years: {}", conf.num_years());
+		return false;
+	}
+	if (conf.has_start_year() && (conf.start_year() < 1 ||
+				conf.start_year() + conf.num_years() - 1 > max_year)) {
+		ctx->console->error("Invalid start_year: {}", conf.start_year());
+		return false;
+	}
+	const std::pair<const char*, double> sizes[] = {
+		{"cell_size", conf.cell_size()},
+		{"cell_margin", conf.cell_margin()},
+		{"font_size", conf.font_size()},
+		{"bigger_font_size", conf.bigger_font_size()},
+		{"line_width", conf.line_width()},
+		{"month_label_height", conf.month_label_height()},
+		{"year_label_width", conf.year_label_width()},
+		{"vertical_dotted_line_x", conf.vertical_dotted_line_x()},
+	};
+	for (const auto& size : sizes) {
+		// Also false for NaN.
+		if (!(size.second >= 0 && size.second <= max_surface_size)) {
+			ctx->console->error("Invalid {}: {}", size.first, size.second);
+			return false;
+		}
+	}
+	if (!(conf.cell_size() > 0)) {
+		ctx->console->error("Invalid cell_size: {}", conf.cell_size());
+		return false;
+	}
+	if (conf.has_vertical_dotted_line_x() &&
+			!(conf.vertical_dotted_line_x() > 0)) {
+		ctx->console->error("Invalid vertical_dotted_line_x: {}",
+				conf.vertical_dotted_line_x());
+		return false;
+	}
+	// As computed by layout_page().
+	double width = (366 + 6) * (conf.cell_size() + conf.cell_margin()) +
+		conf.year_label_width();
+	double height = (conf.num_years() + 2) *
+		(conf.cell_size() + conf.cell_margin()) +
+		conf.month_label_height() + conf.cell_margin();
+	if (width > max_surface_size || height > max_surface_size) {
+		ctx->console->error("Invalid size: {} x {}", width, height);
+		return false;
+	}
+	if (conf.render_threads() < 0 ||
+			conf.render_threads() > max_render_threads) {
+		ctx->console->error("Invalid render_threads: {}",
+				conf.render_threads());
+		return false;
+	}
+	return true;
+}
+
+bool load_holidays(RenderContext *ctx) {
+	const config::CalendarConfig& conf = ctx->conf;
+	if (conf.holiday_size() == 0) {
+		return true;
+	}
+
+	std::vector<HolidayRule> rules;
+	for (int i = 0; i < conf.holiday_size(); i++) {
+		const config::HolidayRule& h = conf.holiday(i);
+		bool valid = 1 <= h.month() && h.month() <= 12;
+		if (h.has_day()) {
+			valid = valid && 1 <= h.day() && h.day() <= 31;
+		} else {
+			valid = valid && 0 <= h.wday() && h.wday() <= 6 &&
+				(h.week() == -1 || (1 <= h.week() && h.week() <= 5));
+		}
+		if (!valid) {
+			ctx->console->error("Invalid holiday: {}", h.ShortDebugString());
+			return false;
+		}
+		rules.push_back({h.month(), h.has_day() ? h.day() : 0, h.wday(),
+				h.week(), h.saturday_to_friday(), h.sunday_to_monday()});
+	}
+	ctx->holidays = HolidayTable(rules);
+	return true;
+}
+
+double calc_offset_width(RenderContext *ctx) {
+	const config::CalendarConfig& conf = ctx->conf;
+	if (conf.first_month() <= 1) {
+		return 0;
+	}
+
+	int d = 0;
+	for (int m = 0; m < conf.first_month() - 1; m++) {
+		d += days_per_months[m];
+	}
+	return d * (conf.cell_size() + conf.cell_margin()) +
+		conf.year_label_width();
+}
+
+double calc_visible_width(RenderContext *ctx) {
+	const config::CalendarConfig& conf = ctx->conf;
+	int d = 0;
+	for (int m = conf.first_month() - 1;
+			m < conf.first_month() + conf.num_months() - 1; m++) {
+		d += days_per_months[m];
+		if (m == 11) {
+			d++;
+		}
+	}
+	double width = d * (conf.cell_size() + conf.cell_margin());
+	if (conf.first_month() == 1) {
+		width += conf.year_label_width() - conf.cell_margin();
+	}
+	width += conf.cell_margin();
+	return width;
+}
+
+void calc_visible_columns(RenderContext *ctx, double left, double right) {
+	const config::CalendarConfig& conf = ctx->conf;
+	ctx->first_visible_column = 366 + 6;
+	ctx->last_visible_column = 0;
+	for (int d = 0; d < 366 + 6; d++) {
+		if (get_day_x(ctx, d) < right &&
+				get_day_x(ctx, d) + conf.cell_size() > left) {
+			ctx->first_visible_column = std::min(ctx->first_visible_column, d);
+			ctx->last_visible_column = d + 1;
+		}
+	}
+	ctx->year_labels_visible = left < conf.year_label_width();
+}
+
+void draw_dashes(RenderContext *ctx, cairo_t *cr, double x, double y,
+		double width, double height)
+{
+	const config::CalendarConfig& conf = ctx->conf;
+	set_rgb(cr, conf.rgb_header());
+	cairo_set_line_width(cr, 1);
+	double dashes[] = {5, 5};
+	cairo_set_dash(cr, dashes, 2, 0);
+	if (conf.dotted_line()) {
+		cairo_rectangle(cr, x, y, width, height);
+		cairo_stroke(cr);
+		count_op(ctx, COUNTER_PATH_OPS);
+		count_op(ctx, COUNTER_STROKES);
+	}
+	if (conf.has_vertical_dotted_line_x()) {
+		cairo_move_to(cr, x + conf.vertical_dotted_line_x(), 0);
+		cairo_line_to(cr, x + conf.vertical_dotted_line_x(), height);
+		cairo_stroke(cr);
+		count_op(ctx, COUNTER_PATH_OPS, 2);
+		count_op(ctx, COUNTER_STROKES);
+	}
+}
+
+// Fills every cache that year() would otherwise fill on first use, so that
+// rows can be drawn from several threads. Those threads then share, and
+// only read:
+// - the special day index and the holiday masks,
+// - the shaped day numbers: glyphs and cairo scaled fonts, which cairo
+//   locks itself, and fallback layouts, laid out and drawn once by
+//   shape_text(),
+// - the icon masks and year templates, if any, used only as sources.
+// Layouts in RenderCache::layouts are never used by those threads.
+void prepare_years(RenderContext *ctx, cairo_t *cr, int this_year) {
+	ScopedTimer timer(ctx->profile, "prepare_years");
+	const config::CalendarConfig& conf = ctx->conf;
+	char buf[4];
+	for (int day = 1; day <= 31; day++) {
+		snprintf(buf, sizeof(buf), "%d", day);
+		get_shaped_text(ctx, cr, conf.number_font_family(), conf.font_size(),
+				PANGO_WEIGHT_SEMIBOLD, buf);
+	}
+	for (int i = 0; i < conf.num_years(); i++) {
+		ctx->holidays.get_mask(this_year + i);
+		if (ctx->first_visible_column < ctx->last_visible_column &&
+				uses_year_templates(ctx)) {
+			get_year_template(ctx, this_year + i, i + 1);
+		}
+	}
+}
+
+int get_num_render_threads(RenderContext *ctx) {
+	const config::CalendarConfig& conf = ctx->conf;
+	if (conf.render_threads() > 0) {
+		return conf.render_threads();
+	}
+	return std::min(max_render_threads,
+			(int)std::max(1u, std::thread::hardware_concurrency()));
+}
+
+// Splits year rows [first_row, last_row) of an image surface into
+// horizontal bands of its buffer, each drawn by its own thread through its
+// own cairo context. (origin_x, origin_y) is where the calendar's origin
+// lies on the surface.
+void draw_years_in_bands(RenderContext *ctx, cairo_surface_t *surface,
+		double origin_x, double origin_y, int this_year, int first_row,
+		int last_row, int num_bands) {
+	const config::CalendarConfig& conf = ctx->conf;
+	unsigned char *data = cairo_image_surface_get_data(surface);
+	int width = cairo_image_surface_get_width(surface);
+	int height = cairo_image_surface_get_height(surface);
+	int stride = cairo_image_surface_get_stride(surface);
+
+	// Band k holds rows [band_rows[k], band_rows[k + 1]) and starts halfway
+	// through the margin above its first row.
+	std::vector<int> band_rows;
+	std::vector<int> band_y;
+	for (int k = 0; k <= num_bands; k++) {
+		int row = first_row + k * (last_row - first_row) / num_bands;
+		band_rows.push_back(row);
+		if (k == 0) {
+			band_y.push_back(0);
+		} else if (k == num_bands) {
+			band_y.push_back(height);
+		} else {
+			int y = round(origin_y + get_day_y(ctx, row + 1) -
+					conf.cell_margin() / 2);
+			band_y.push_back(std::max(band_y.back(), std::min(y, height)));
+		}
+	}
+
+	cairo_surface_flush(surface);
+	auto draw_band = [&](int k) {
+		cairo_surface_t *band = cairo_image_surface_create_for_data(
+				data + (size_t)band_y[k] * stride, CAIRO_FORMAT_ARGB32,
+				width, band_y[k + 1] - band_y[k], stride);
+		cairo_t *cr = cairo_create(band);
+		cairo_translate(cr, origin_x, origin_y - band_y[k]);
+		for (int i = band_rows[k]; i < band_rows[k + 1]; i++) {
+			ScopedTimer timer(ctx->profile, "year");
+			year(ctx, cr, i, this_year + i);
+		}
+		cairo_destroy(cr);
+		cairo_surface_destroy(band);
+	};
+	// Bands no thread could be started for are drawn on this one.
+	std::vector<std::thread> threads;
+	int k = 0;
+	try {
+		for (; k < num_bands; k++) {
+			threads.emplace_back(draw_band, k);
+		}
+	} catch (const std::system_error& e) {
+		ctx->console->warn("Cannot start render thread: {}", e.what());
+	}
+	for (; k < num_bands; k++) {
+		draw_band(k);
+	}
+	for (std::thread& thread : threads) {
+		thread.join();
+	}
+	cairo_surface_mark_dirty(surface);
+}
+
+// Draws the part of the calendar between top and bottom, in calendar
+// coordinates. cr is already translated by (page.origin_x, origin_y).
+void draw_calendar(RenderContext *ctx, cairo_t *cr, double origin_y,
+		double top, double bottom) {
+	const config::CalendarConfig& conf = ctx->conf;
+	const PageLayout& page = ctx->page;
+	if (top < get_day_y(ctx, 1)) {
+		{
+			ScopedTimer timer(ctx->profile, "wday_label");
+			wday_label(ctx, cr);
+		}
+		ScopedTimer timer(ctx->profile, "month_label");
+		month_label(ctx, cr);
+	}
+
+	int first_row = conf.num_years();
+	int last_row = 0;
+	for (int i = 0; i < conf.num_years(); i++) {
+		if (get_day_y(ctx, i + 1) < bottom &&
+				get_day_y(ctx, i + 1) + conf.cell_size() > top) {
+			first_row = std::min(first_row, i);
+			last_row = i + 1;
+		}
+	}
+
+	if (first_row < last_row) {
+		{
+			ScopedTimer timer(ctx->profile, "year_label");
+			year_label(ctx, cr, page.this_year, first_row, last_row);
+		}
+		int num_bands = std::min(page.num_threads, last_row - first_row);
+		if (num_bands > 1) {
+			draw_years_in_bands(ctx, cairo_get_target(cr), page.origin_x,
+					origin_y, page.this_year, first_row, last_row, num_bands);
+		} else {
+			for (int i = first_row; i < last_row; i++) {
+				ScopedTimer timer(ctx->profile, "year");
+				year(ctx, cr, i, page.this_year + i);
+			}
+		}
+	}
+
+	if (bottom > get_day_y(ctx, conf.num_years() + 1)) {
+		ScopedTimer timer(ctx->profile, "footer");
+		set_rgb(cr, conf.rgb_header());
+		draw_text_on_bottom_left(ctx, cr);
+		draw_text_on_bottom_right(ctx, cr);
+	}
+
+	ScopedTimer timer(ctx->profile, "draw_dashes");
+	draw_dashes(ctx, cr, page.visible_left, 0, page.visible_width,
+			page.surface_height);
+}
+
+// Converts a row of a CAIRO_FORMAT_ARGB32 surface, which is premultiplied
+// and native-endian, to the RGBA bytes libpng expects.
+void unpremultiply_row(const unsigned char *src, unsigned char *dst,
+		int width) {
+	for (int x = 0; x < width; x++) {
+		uint32_t pixel;
+		memcpy(&pixel, src + x * 4, sizeof(pixel));
+		uint32_t alpha = pixel >> 24;
+		unsigned char *rgba = dst + x * 4;
+		if (alpha == 0) {
+			memset(rgba, 0, 4);
+			continue;
+		}
+		rgba[0] = (((pixel >> 16) & 0xff) * 255 + alpha / 2) / alpha;
+		rgba[1] = (((pixel >> 8) & 0xff) * 255 + alpha / 2) / alpha;
+		rgba[2] = ((pixel & 0xff) * 255 + alpha / 2) / alpha;
+		rgba[3] = alpha;
+	}
+}
+
+// Hands the bytes of one output to the caller's write function. SVG
+// output whose paths are shared is held back until it is whole.
+struct OutputStream {
+	const CalendarWriteFunc *write;
+	config::OutputType output_type;
+	Profile *profile;
+	bool hold_svg;
+	std::string svg;
+};
+
+void init_output_stream(RenderContext *ctx, const CalendarWriteFunc *write,
+		config::OutputType output_type, OutputStream *stream) {
+	stream->write = write;
+	stream->output_type = output_type;
+	stream->profile = ctx->profile;
+	stream->hold_svg = output_type == config::OutputType::SVG &&
+		ctx->conf.share_svg_paths();
+}
+
+bool write_stream_data(OutputStream *stream, const unsigned char *data,
+		size_t length) {
+	if (stream->hold_svg) {
+		stream->svg.append(reinterpret_cast<const char*>(data), length);
+		return true;
+	}
+	if (stream->profile != NULL) {
+		stream->profile->count(COUNTER_BYTES_WRITTEN, length);
+	}
+	return (*stream->write)(stream->output_type, data, length);
+}
+
+cairo_status_t write_to_stream(void *closure, const unsigned char *data,
+		unsigned int length) {
+	OutputStream *stream = static_cast<OutputStream*>(closure);
+	if (!write_stream_data(stream, data, length)) {
+		return CAIRO_STATUS_WRITE_ERROR;
+	}
+	return CAIRO_STATUS_SUCCESS;
+}
+
+void write_png_data(png_structp png, png_bytep data, png_size_t length) {
+	OutputStream *stream = static_cast<OutputStream*>(png_get_io_ptr(png));
+	if (!write_stream_data(stream, data, length)) {
+		png_error(png, "write error");
+	}
+}
+
+// Writes out the SVG held back by the stream, with its paths shared.
+bool write_shared_svg(OutputStream *stream) {
+	std::string svg = share_svg_paths(stream->svg);
+	stream->hold_svg = false;
+	stream->svg.clear();
+	return write_stream_data(stream,
+			reinterpret_cast<const unsigned char*>(svg.data()), svg.size());
+}
+
+void flush_png_data(png_structp png) {
+}
+
+// Draws the PNG output tile by tile, each one full width and
+// conf.tile_height() pixels high, and writes its rows out before drawing
+// the next. Tiles are replayed from recording if it is not NULL.
+bool write_png_in_tiles(RenderContext *ctx, OutputStream *stream,
+		cairo_surface_t *recording) {
+	const config::CalendarConfig& conf = ctx->conf;
+	const PageLayout& page = ctx->page;
+	int width = page.print_width;
+	int height = page.surface_height;
+	int tile_height = std::min(conf.tile_height(), height);
+
+	png_structp png = png_create_write_struct(PNG_LIBPNG_VER_STRING,
+			NULL, NULL, NULL);
+	png_infop info = png == NULL ? NULL : png_create_info_struct(png);
+	cairo_surface_t *tile =
+		cairo_image_surface_create(CAIRO_FORMAT_ARGB32, width, tile_height);
+	std::vector<unsigned char> row(width * 4);
+	const char *outer_phase = get_current_phase();
+	if (info == NULL || setjmp(png_jmpbuf(png))) {
+		set_current_phase(outer_phase);
+		ctx->console->error("PNG: cannot write");
+		png_destroy_write_struct(&png, &info);
+		cairo_surface_destroy(tile);
+		return false;
+	}
+
+	png_set_write_fn(png, stream, write_png_data, flush_png_data);
+	png_set_IHDR(png, info, width, height, 8, PNG_COLOR_TYPE_RGB_ALPHA,
+			PNG_INTERLACE_NONE, PNG_COMPRESSION_TYPE_DEFAULT,
+			PNG_FILTER_TYPE_DEFAULT);
+	png_write_info(png, info);
+
+	if (recording == NULL && page.num_threads > 1) {
+		cairo_t *cr = cairo_create(tile);
+		prepare_years(ctx, cr, page.this_year);
+		cairo_destroy(cr);
+	}
+	for (int y = 0; y < height; y += tile_height) {
+		cairo_t *cr = cairo_create(tile);
+		cairo_set_operator(cr, CAIRO_OPERATOR_CLEAR);
+		cairo_paint(cr);
+		count_op(ctx, COUNTER_PAINTS);
+		cairo_set_operator(cr, CAIRO_OPERATOR_OVER);
+		if (recording != NULL) {
+			ScopedTimer timer(ctx->profile, "replay");
+			cairo_set_source_surface(cr, recording, 0, -y);
+			cairo_paint(cr);
+			count_op(ctx, COUNTER_PAINTS);
+		} else {
+			cairo_translate(cr, page.origin_x, -y);
+			draw_calendar(ctx, cr, -y, y, y + tile_height);
+		}
+		cairo_destroy(cr);
+
+		// Not a ScopedTimer, as png_write_row() may longjmp() out.
+		auto start = Profile::Clock::now();
+		set_current_phase("finish");
+		cairo_surface_flush(tile);
+		const unsigned char *data = cairo_image_surface_get_data(tile);
+		int stride = cairo_image_surface_get_stride(tile);
+		for (int i = 0; i < tile_height && y + i < height; i++) {
+			unpremultiply_row(data + i * stride, row.data(), width);
+			png_write_row(png, row.data());
+		}
+		set_current_phase(outer_phase);
+		if (ctx->profile != NULL) {
+			ctx->profile->add("finish", start, Profile::Clock::now());
+		}
+	}
+
+	png_write_end(png, NULL);
+	png_destroy_write_struct(&png, &info);
+	cairo_surface_destroy(tile);
+	return true;
+}
+
+// PNG surfaces are only written out by finish_output_surface().
+cairo_surface_t* create_output_surface(OutputStream *stream,
+		double width, double height) {
+	switch (stream->output_type) {
+		case config::OutputType::PDF:
+			return cairo_pdf_surface_create_for_stream(write_to_stream,
+					stream, width, height);
+		case config::OutputType::PNG:
+			return cairo_image_surface_create (CAIRO_FORMAT_ARGB32,
+					width, height);
+		default:
+			return cairo_svg_surface_create_for_stream(write_to_stream,
+					stream, width, height);
+	}
+}
+
+bool finish_output_surface(RenderContext *ctx, cairo_surface_t *surface,
+		OutputStream *stream) {
+	ScopedTimer timer(ctx->profile, "finish");
+	cairo_status_t status = CAIRO_STATUS_SUCCESS;
+	if (stream->output_type == config::OutputType::PNG) {
+		status = cairo_surface_write_to_png_stream(surface, write_to_stream,
+				stream);
+	}
+	cairo_surface_finish(surface);
+	if (status == CAIRO_STATUS_SUCCESS) {
+		status = cairo_surface_status(surface);
+	}
+	if (status == CAIRO_STATUS_SUCCESS && stream->hold_svg &&
+			!write_shared_svg(stream)) {
+		status = CAIRO_STATUS_WRITE_ERROR;
+	}
+	if (status != CAIRO_STATUS_SUCCESS) {
+		ctx->console->error("{}: {}",
+				config::OutputType_Name(stream->output_type),
+				cairo_status_to_string(status));
+		return false;
+	}
+	return true;
+}
+
+// Draws the calendar once and writes every output. With several outputs,
+// the calendar is drawn into a recording surface that is then replayed.
+bool write_outputs(RenderContext *ctx, const CalendarWriteFunc& write) {
+	const PageLayout& page = ctx->page;
+	const std::vector<config::OutputType>& output_types = ctx->output_types;
+	OutputStream stream;
+	init_output_stream(ctx, &write, output_types[0], &stream);
+	cairo_surface_t *surface = NULL;
+	if (output_types.size() == 1) {
+		surface = create_output_surface(&stream,
+				page.print_width, page.surface_height);
+	} else {
+		cairo_rectangle_t extents =
+			{0, 0, page.print_width, (double)page.surface_height};
+		surface = cairo_recording_surface_create(CAIRO_CONTENT_COLOR_ALPHA,
+				&extents);
+	}
+	cairo_t *cr = cairo_create(surface);
+	cairo_translate(cr, page.origin_x, 0);
+
+	if (page.num_threads > 1) {
+		prepare_years(ctx, cr, page.this_year);
+	}
+	draw_calendar(ctx, cr, 0, 0, page.surface_height);
+	cairo_destroy(cr);
+
+	bool ok = true;
+	if (output_types.size() == 1) {
+		ok = finish_output_surface(ctx, surface, &stream);
+	} else {
+		for (config::OutputType output_type : output_types) {
+			OutputStream target_stream;
+			init_output_stream(ctx, &write, output_type, &target_stream);
+			if (output_type == config::OutputType::PNG &&
+					ctx->conf.tile_height() > 0) {
+				ok = write_png_in_tiles(ctx, &target_stream, surface) && ok;
+				continue;
+			}
+			cairo_surface_t *target = create_output_surface(&target_stream,
+					page.print_width, page.surface_height);
+			{
+				ScopedTimer timer(ctx->profile, "replay");
+				cairo_t *target_cr = cairo_create(target);
+				cairo_set_source_surface(target_cr, surface, 0, 0);
+				cairo_paint(target_cr);
+				count_op(ctx, COUNTER_PAINTS);
+				cairo_destroy(target_cr);
+			}
+			ok = finish_output_surface(ctx, target, &target_stream) && ok;
+			cairo_surface_destroy(target);
+		}
+	}
+	cairo_surface_destroy(surface);
+	return ok;
+}
+
+// Computes where the calendar lies on the page and which of its columns
+// are visible. Fails if nothing of it would be printed.
+bool layout_page(RenderContext *ctx) {
+	const config::CalendarConfig& conf = ctx->conf;
+	PageLayout& page = ctx->page;
+	int surface_width = (366 + 6) * (conf.cell_size() + conf.cell_margin()) +
+			conf.year_label_width();
+
+	double offset_width = calc_offset_width(ctx);
+	double visible_width = calc_visible_width(ctx);
+	double print_width = visible_width;
+	if (conf.has_vertical_dotted_line_x()) {
+		print_width = conf.vertical_dotted_line_x();
+	}
+
+	if (!(print_width > 0)) {
+		ctx->console->error("Invalid print width: {}", print_width);
+		return false;
+	}
+
+	int surface_height = (conf.num_years() + 2) *
+			(conf.cell_size() + conf.cell_margin()) +
+			conf.month_label_height() + conf.cell_margin();
+	ctx->console->info("Size: {} x {}", surface_width, surface_height);
+	ctx->console->info("Offset: {}", offset_width);
+	ctx->console->info("Visible: {}", visible_width);
+
+	page.this_year = get_start_year(conf, ctx->profile);
+	page.offset_width = offset_width;
+	page.visible_left = std::max(0.0, offset_width - conf.cell_margin());
+	page.visible_width = visible_width;
+	page.print_width = print_width;
+	page.surface_height = surface_height;
+	page.origin_x = offset_width != 0 ? -offset_width + conf.cell_margin() : 0;
+	page.num_threads = ctx->raster_output ? get_num_render_threads(ctx) : 1;
+	calc_visible_columns(ctx, page.visible_left,
+			page.visible_left + page.print_width);
+	return true;
+}
+
+// What a layout, a shaped label or a recording surface is taken to hold,
+// for get_render_cache_size().
+const size_t small_cache_entry_size = 1 << 10;
+const size_t recording_surface_size = 64 << 10;
+
+size_t get_surface_size(cairo_surface_t *surface) {
+	if (surface == NULL) {
+		return 0;
+	}
+	if (cairo_surface_get_type(surface) == CAIRO_SURFACE_TYPE_IMAGE) {
+		return (size_t)cairo_image_surface_get_stride(surface) *
+			cairo_image_surface_get_height(surface);
+	}
+	return recording_surface_size;
+}
+
+int get_this_year(Profile *profile) {
+	time_t rawtime;
+	struct tm timeinfo;
+
+	time(&rawtime);
+	localtime_r(&rawtime, &timeinfo);
+	if (profile != NULL) {
+		profile->count(COUNTER_LOCALTIME_CALLS, 1);
+	}
+	return timeinfo.tm_year + 1900;
+}
+
+}  // namespace
+
+int get_start_year(const config::CalendarConfig& conf, Profile *profile) {
+	if (conf.has_start_year()) {
+		return conf.start_year();
+	}
+	return get_this_year(profile);
+}
+
+std::vector<config::OutputType> get_output_types(
+		const config::CalendarConfig& conf) {
+	std::vector<config::OutputType> output_types;
+	for (int i = 0; i < conf.output_types_size(); i++) {
+		config::OutputType output_type = conf.output_types(i);
+		if (std::find(output_types.begin(), output_types.end(),
+					output_type) == output_types.end()) {
+			output_types.push_back(output_type);
+		}
+	}
+	if (output_types.empty()) {
+		output_types.push_back(conf.output_type());
+	}
+	return output_types;
+}
+
+RenderCache* create_render_cache() {
+	return new RenderCache();
+}
+
+void free_render_cache(RenderCache *cache) {
+	clear_render_cache(cache);
+	delete cache;
+}
+
+size_t get_render_cache_size(const RenderCache *cache) {
+	size_t size = (cache->layouts.size() + cache->shaped_texts.size()) *
+		small_cache_entry_size;
+	for (const auto& entry : cache->icons) {
+		// The SVG in the key, and the mask drawn from it. A recorded mask
+		// is taken to hold about as much as the SVG.
+		size_t svg_size = std::get<0>(entry.first).size();
+		size_t mask_size = get_surface_size(entry.second.mask);
+		if (cairo_surface_get_type(entry.second.mask) ==
+				CAIRO_SURFACE_TYPE_RECORDING) {
+			mask_size = std::max(mask_size, svg_size);
+		}
+		size += svg_size + mask_size;
+	}
+	for (const auto& entry : cache->year_templates) {
+		size += get_surface_size(entry.second);
+	}
+	return size;
+}
+
+void clear_render_cache(RenderCache *cache) {
+	free_year_templates(cache);
+	free_shaped_texts(cache);
+	free_pango_layouts(cache);
+	free_icons(cache);
+}
+
+RenderContext* create_render_context(const config::CalendarConfig& conf,
+		const std::shared_ptr<spdlog::logger>& console, RenderCache *cache,
+		Profile *profile) {
+	RenderContext *ctx = new RenderContext();
+	ctx->conf = conf;
+	ctx->console = console;
+	ctx->owns_cache = cache == NULL;
+	ctx->profile = profile;
+	ctx->cache = ctx->owns_cache ? create_render_cache() : cache;
+	if (!check_config(ctx) || !load_holidays(ctx)) {
+		free_render_context(ctx);
+		return NULL;
+	}
+	ctx->special_days = SpecialDayIndex(ctx->conf);
+
+	ctx->output_types = get_output_types(conf);
+	ctx->raster_output = ctx->output_types.size() == 1 &&
+		ctx->output_types[0] == config::OutputType::PNG;
+	if (!layout_page(ctx) || !load_icons(ctx)) {
+		free_render_context(ctx);
+		return NULL;
+	}
+	return ctx;
+}
+
+void free_render_context(RenderContext *ctx) {
+	if (ctx->owns_cache) {
+		free_render_cache(ctx->cache);
+	}
+	delete ctx;
+}
+
+void set_render_profile(RenderContext *ctx, Profile *profile) {
+	ctx->profile = profile;
+}
+
+bool render_calendar(RenderContext *ctx, const CalendarWriteFunc& write) {
+	if (ctx->raster_output && ctx->conf.tile_height() > 0) {
+		OutputStream stream;
+		init_output_stream(ctx, &write, config::OutputType::PNG, &stream);
+		return write_png_in_tiles(ctx, &stream, NULL);
+	}
+	return write_outputs(ctx, write);
+}
@@ -0,0 +1,69 @@
+#ifndef CALENDAR_H
+#define CALENDAR_H
+
+#include <spdlog/spdlog.h>
+#include <stddef.h>
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "config.pb.h"
+
+// Receives the bytes of an output, in order, as they are produced. Returns
+// false to stop writing that output.
+typedef std::function<bool(config::OutputType output_type,
+		const unsigned char *data, size_t length)> CalendarWriteFunc;
+
+// The config being rendered, with everything derived from it and the caches
+// filled while drawing. Contexts that do not share a RenderCache can be
+// used at the same time from different threads.
+struct RenderContext;
+
+// Pango layouts, shaped labels, icons and year templates kept across
+// renders. Cairo, Pango and librsvg objects must stay on one thread, so a
+// cache may only be used by one render at a time, and always from the same
+// thread. The only exception is the band threads of a PNG render with
+// render_threads, which read the cache once the render's own thread has
+// filled it.
+struct RenderCache;
+
+class Profile;
+
+// The first year conf shows. Reading the clock for it counts a localtime()
+// call in profile, if not NULL.
+int get_start_year(const config::CalendarConfig& conf,
+		Profile *profile = NULL);
+
+// The outputs a render of conf writes, in order, each once.
+std::vector<config::OutputType> get_output_types(
+		const config::CalendarConfig& conf);
+
+RenderCache* create_render_cache();
+void free_render_cache(RenderCache *cache);
+// Roughly the bytes held by cache.
+size_t get_render_cache_size(const RenderCache *cache);
+// Caches kept across many configs, by the daemon or a batch job, are
+// emptied once they hold more bytes than this, so that configs changing
+// with every render do not grow them forever.
+const size_t MAX_RENDER_CACHE_SIZE = 256 << 20;
+// Empties cache. No context using it may be rendered at the same time.
+void clear_render_cache(RenderCache *cache);
+
+// Returns NULL, after logging why, if conf cannot be rendered. Without a
+// cache, the context gets a cache of its own. Otherwise cache must outlive
+// the context. The setup is timed into profile, if not NULL, as by
+// set_render_profile().
+RenderContext* create_render_context(const config::CalendarConfig& conf,
+		const std::shared_ptr<spdlog::logger>& console,
+		RenderCache *cache = NULL, Profile *profile = NULL);
+void free_render_context(RenderContext *ctx);
+
+// Times the phases of every later render of ctx into profile, which must
+// outlive ctx. NULL stops timing.
+void set_render_profile(RenderContext *ctx, Profile *profile);
+
+// Draws the calendar and passes each of its outputs to write.
+bool render_calendar(RenderContext *ctx, const CalendarWriteFunc& write);
+
+#endif	// CALENDAR_H
@@ -1,208 +1,350 @@
 // Generated by the protocol buffer compiler.  DO NOT EDIT!
 // source: config.proto
 
-#define INTERNAL_SUPPRESS_PROTOBUF_FIELD_DEPRECATION
 #include "config.pb.h"
 
 #include <algorithm>
 
-#include <google/protobuf/stubs/common.h>
-#include <google/protobuf/stubs/port.h>
-#include <google/protobuf/stubs/once.h>
 #include <google/protobuf/io/coded_stream.h>
-#include <google/protobuf/wire_format_lite_inl.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
 #include <google/protobuf/descriptor.h>
 #include <google/protobuf/generated_message_reflection.h>
 #include <google/protobuf/reflection_ops.h>
 #include <google/protobuf/wire_format.h>
 // @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
 
-namespace config {
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
 
-namespace {
-
-const ::google::protobuf::Descriptor* CalendarConfig_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  CalendarConfig_reflection_ = NULL;
-const ::google::protobuf::Descriptor* SpecialDay_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  SpecialDay_reflection_ = NULL;
-const ::google::protobuf::Descriptor* RGB_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  RGB_reflection_ = NULL;
-const ::google::protobuf::EnumDescriptor* OutputType_descriptor_ = NULL;
-
-}  // namespace
-
-
-void protobuf_AssignDesc_config_2eproto() GOOGLE_ATTRIBUTE_COLD;
-void protobuf_AssignDesc_config_2eproto() {
-  protobuf_AddDesc_config_2eproto();
-  const ::google::protobuf::FileDescriptor* file =
-    ::google::protobuf::DescriptorPool::generated_pool()->FindFileByName(
-      "config.proto");
-  GOOGLE_CHECK(file != NULL);
-  CalendarConfig_descriptor_ = file->message_type(0);
-  static const int CalendarConfig_offsets_[23] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CalendarConfig, num_years_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CalendarConfig, first_month_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CalendarConfig, num_months_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CalendarConfig, special_day_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CalendarConfig, cell_size_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CalendarConfig, cell_margin_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CalendarConfig, font_size_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CalendarConfig, bigger_font_size_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CalendarConfig, line_width_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CalendarConfig, month_label_height_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CalendarConfig, year_label_width_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CalendarConfig, rgb_header_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CalendarConfig, rgb_header_sunday_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CalendarConfig, rgb_month_line_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CalendarConfig, rgb_holiday_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CalendarConfig, bottom_left_label_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CalendarConfig, bottom_right_label_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CalendarConfig, header_font_family_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CalendarConfig, number_font_family_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CalendarConfig, quote_font_family_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CalendarConfig, dotted_line_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CalendarConfig, vertical_dotted_line_x_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CalendarConfig, output_type_),
+namespace config {
+PROTOBUF_CONSTEXPR CalendarConfig::CalendarConfig(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.special_day_)*/{}
+  , /*decltype(_impl_.holiday_)*/{}
+  , /*decltype(_impl_.output_types_)*/{}
+  , /*decltype(_impl_.bottom_left_label_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.bottom_right_label_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.header_font_family_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.number_font_family_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.quote_font_family_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.output_name_)*/{nullptr, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.rgb_header_)*/nullptr
+  , /*decltype(_impl_.rgb_header_sunday_)*/nullptr
+  , /*decltype(_impl_.rgb_month_line_)*/nullptr
+  , /*decltype(_impl_.rgb_holiday_)*/nullptr
+  , /*decltype(_impl_.cell_size_)*/0
+  , /*decltype(_impl_.cell_margin_)*/0
+  , /*decltype(_impl_.font_size_)*/0
+  , /*decltype(_impl_.bigger_font_size_)*/0
+  , /*decltype(_impl_.line_width_)*/0
+  , /*decltype(_impl_.month_label_height_)*/0
+  , /*decltype(_impl_.year_label_width_)*/0
+  , /*decltype(_impl_.vertical_dotted_line_x_)*/0
+  , /*decltype(_impl_.dotted_line_)*/false
+  , /*decltype(_impl_.output_type_)*/0
+  , /*decltype(_impl_.tile_height_)*/0
+  , /*decltype(_impl_.start_year_)*/0
+  , /*decltype(_impl_.share_svg_paths_)*/true
+  , /*decltype(_impl_.num_years_)*/30
+  , /*decltype(_impl_.first_month_)*/1
+  , /*decltype(_impl_.num_months_)*/12
+  , /*decltype(_impl_.render_threads_)*/1} {}
+struct CalendarConfigDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CalendarConfigDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CalendarConfigDefaultTypeInternal() {}
+  union {
+    CalendarConfig _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CalendarConfigDefaultTypeInternal _CalendarConfig_default_instance_;
+PROTOBUF_CONSTEXPR SpecialDay::SpecialDay(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.svg_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.rgb_)*/nullptr
+  , /*decltype(_impl_.month_)*/0
+  , /*decltype(_impl_.day_)*/0
+  , /*decltype(_impl_.first_year_)*/0
+  , /*decltype(_impl_.year_)*/0} {}
+struct SpecialDayDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SpecialDayDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SpecialDayDefaultTypeInternal() {}
+  union {
+    SpecialDay _instance;
   };
-  CalendarConfig_reflection_ =
-    ::google::protobuf::internal::GeneratedMessageReflection::NewGeneratedMessageReflection(
-      CalendarConfig_descriptor_,
-      CalendarConfig::default_instance_,
-      CalendarConfig_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CalendarConfig, _has_bits_[0]),
-      -1,
-      -1,
-      sizeof(CalendarConfig),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CalendarConfig, _internal_metadata_),
-      -1);
-  SpecialDay_descriptor_ = file->message_type(1);
-  static const int SpecialDay_offsets_[6] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SpecialDay, month_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SpecialDay, day_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SpecialDay, svg_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SpecialDay, first_year_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SpecialDay, year_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SpecialDay, rgb_),
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SpecialDayDefaultTypeInternal _SpecialDay_default_instance_;
+PROTOBUF_CONSTEXPR RGB::RGB(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.red_)*/0
+  , /*decltype(_impl_.green_)*/0
+  , /*decltype(_impl_.blue_)*/0} {}
+struct RGBDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR RGBDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~RGBDefaultTypeInternal() {}
+  union {
+    RGB _instance;
   };
-  SpecialDay_reflection_ =
-    ::google::protobuf::internal::GeneratedMessageReflection::NewGeneratedMessageReflection(
-      SpecialDay_descriptor_,
-      SpecialDay::default_instance_,
-      SpecialDay_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SpecialDay, _has_bits_[0]),
-      -1,
-      -1,
-      sizeof(SpecialDay),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SpecialDay, _internal_metadata_),
-      -1);
-  RGB_descriptor_ = file->message_type(2);
-  static const int RGB_offsets_[3] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(RGB, red_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(RGB, green_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(RGB, blue_),
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RGBDefaultTypeInternal _RGB_default_instance_;
+PROTOBUF_CONSTEXPR HolidayRule::HolidayRule(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.month_)*/0
+  , /*decltype(_impl_.day_)*/0
+  , /*decltype(_impl_.wday_)*/0
+  , /*decltype(_impl_.week_)*/0
+  , /*decltype(_impl_.saturday_to_friday_)*/false
+  , /*decltype(_impl_.sunday_to_monday_)*/false} {}
+struct HolidayRuleDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR HolidayRuleDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~HolidayRuleDefaultTypeInternal() {}
+  union {
+    HolidayRule _instance;
   };
-  RGB_reflection_ =
-    ::google::protobuf::internal::GeneratedMessageReflection::NewGeneratedMessageReflection(
-      RGB_descriptor_,
-      RGB::default_instance_,
-      RGB_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(RGB, _has_bits_[0]),
-      -1,
-      -1,
-      sizeof(RGB),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(RGB, _internal_metadata_),
-      -1);
-  OutputType_descriptor_ = file->enum_type(0);
-}
-
-namespace {
-
-GOOGLE_PROTOBUF_DECLARE_ONCE(protobuf_AssignDescriptors_once_);
-inline void protobuf_AssignDescriptorsOnce() {
-  ::google::protobuf::GoogleOnceInit(&protobuf_AssignDescriptors_once_,
-                 &protobuf_AssignDesc_config_2eproto);
-}
-
-void protobuf_RegisterTypes(const ::std::string&) GOOGLE_ATTRIBUTE_COLD;
-void protobuf_RegisterTypes(const ::std::string&) {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-      CalendarConfig_descriptor_, &CalendarConfig::default_instance());
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-      SpecialDay_descriptor_, &SpecialDay::default_instance());
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-      RGB_descriptor_, &RGB::default_instance());
-}
-
-}  // namespace
-
-void protobuf_ShutdownFile_config_2eproto() {
-  delete CalendarConfig::default_instance_;
-  delete CalendarConfig_reflection_;
-  delete SpecialDay::default_instance_;
-  delete SpecialDay_reflection_;
-  delete RGB::default_instance_;
-  delete RGB_reflection_;
-}
-
-void protobuf_AddDesc_config_2eproto() GOOGLE_ATTRIBUTE_COLD;
-void protobuf_AddDesc_config_2eproto() {
-  static bool already_here = false;
-  if (already_here) return;
-  already_here = true;
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  ::google::protobuf::DescriptorPool::InternalAddGeneratedFile(
-    "\n\014config.proto\022\006config\"\243\005\n\016CalendarConfi"
-    "g\022\025\n\tnum_years\030\001 \001(\005:\00230\022\026\n\013first_month\030"
-    "\002 \001(\005:\0011\022\026\n\nnum_months\030\003 \001(\005:\00212\022\'\n\013spec"
-    "ial_day\030\004 \003(\0132\022.config.SpecialDay\022\021\n\tcel"
-    "l_size\030\005 \001(\001\022\023\n\013cell_margin\030\006 \001(\001\022\021\n\tfon"
-    "t_size\030\007 \001(\001\022\030\n\020bigger_font_size\030\010 \001(\001\022\022"
-    "\n\nline_width\030\t \001(\001\022\032\n\022month_label_height"
-    "\030\n \001(\001\022\030\n\020year_label_width\030\013 \001(\001\022\037\n\nrgb_"
-    "header\030\014 \001(\0132\013.config.RGB\022&\n\021rgb_header_"
-    "sunday\030\r \001(\0132\013.config.RGB\022#\n\016rgb_month_l"
-    "ine\030\016 \001(\0132\013.config.RGB\022 \n\013rgb_holiday\030\017 "
-    "\001(\0132\013.config.RGB\022\031\n\021bottom_left_label\030\020 "
-    "\001(\t\022\032\n\022bottom_right_label\030\021 \001(\t\022\032\n\022heade"
-    "r_font_family\030\022 \001(\t\022\032\n\022number_font_famil"
-    "y\030\023 \001(\t\022\031\n\021quote_font_family\030\024 \001(\t\022\032\n\013do"
-    "tted_line\030\025 \001(\010:\005false\022\036\n\026vertical_dotte"
-    "d_line_x\030\026 \001(\001\022,\n\013output_type\030\027 \001(\0162\022.co"
-    "nfig.OutputType:\003SVG\"q\n\nSpecialDay\022\r\n\005mo"
-    "nth\030\001 \002(\005\022\013\n\003day\030\002 \002(\005\022\013\n\003svg\030\003 \001(\t\022\022\n\nf"
-    "irst_year\030\004 \001(\005\022\014\n\004year\030\005 \001(\005\022\030\n\003rgb\030\006 \001"
-    "(\0132\013.config.RGB\"/\n\003RGB\022\013\n\003red\030\001 \002(\005\022\r\n\005g"
-    "reen\030\002 \002(\005\022\014\n\004blue\030\003 \002(\005*\'\n\nOutputType\022\007"
-    "\n\003SVG\020\000\022\007\n\003PDF\020\001\022\007\n\003PNG\020\002", 905);
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedFile(
-    "config.proto", &protobuf_RegisterTypes);
-  CalendarConfig::default_instance_ = new CalendarConfig();
-  SpecialDay::default_instance_ = new SpecialDay();
-  RGB::default_instance_ = new RGB();
-  CalendarConfig::default_instance_->InitAsDefaultInstance();
-  SpecialDay::default_instance_->InitAsDefaultInstance();
-  RGB::default_instance_->InitAsDefaultInstance();
-  ::google::protobuf::internal::OnShutdown(&protobuf_ShutdownFile_config_2eproto);
-}
-
-// Force AddDescriptors() to be called at static initialization time.
-struct StaticDescriptorInitializer_config_2eproto {
-  StaticDescriptorInitializer_config_2eproto() {
-    protobuf_AddDesc_config_2eproto();
-  }
-} static_descriptor_initializer_config_2eproto_;
-const ::google::protobuf::EnumDescriptor* OutputType_descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return OutputType_descriptor_;
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 HolidayRuleDefaultTypeInternal _HolidayRule_default_instance_;
+PROTOBUF_CONSTEXPR CalendarBatch::CalendarBatch(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.config_file_)*/{}
+  , /*decltype(_impl_.config_)*/{}
+  , /*decltype(_impl_.jobs_)*/1} {}
+struct CalendarBatchDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CalendarBatchDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CalendarBatchDefaultTypeInternal() {}
+  union {
+    CalendarBatch _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CalendarBatchDefaultTypeInternal _CalendarBatch_default_instance_;
+}  // namespace config
+static ::_pb::Metadata file_level_metadata_config_2eproto[5];
+static const ::_pb::EnumDescriptor* file_level_enum_descriptors_config_2eproto[1];
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_config_2eproto = nullptr;
+
+const uint32_t TableStruct_config_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  PROTOBUF_FIELD_OFFSET(::config::CalendarConfig, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::config::CalendarConfig, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::config::CalendarConfig, _impl_.num_years_),
+  PROTOBUF_FIELD_OFFSET(::config::CalendarConfig, _impl_.first_month_),
+  PROTOBUF_FIELD_OFFSET(::config::CalendarConfig, _impl_.num_months_),
+  PROTOBUF_FIELD_OFFSET(::config::CalendarConfig, _impl_.special_day_),
+  PROTOBUF_FIELD_OFFSET(::config::CalendarConfig, _impl_.cell_size_),
+  PROTOBUF_FIELD_OFFSET(::config::CalendarConfig, _impl_.cell_margin_),
+  PROTOBUF_FIELD_OFFSET(::config::CalendarConfig, _impl_.font_size_),
+  PROTOBUF_FIELD_OFFSET(::config::CalendarConfig, _impl_.bigger_font_size_),
+  PROTOBUF_FIELD_OFFSET(::config::CalendarConfig, _impl_.line_width_),
+  PROTOBUF_FIELD_OFFSET(::config::CalendarConfig, _impl_.month_label_height_),
+  PROTOBUF_FIELD_OFFSET(::config::CalendarConfig, _impl_.year_label_width_),
+  PROTOBUF_FIELD_OFFSET(::config::CalendarConfig, _impl_.rgb_header_),
+  PROTOBUF_FIELD_OFFSET(::config::CalendarConfig, _impl_.rgb_header_sunday_),
+  PROTOBUF_FIELD_OFFSET(::config::CalendarConfig, _impl_.rgb_month_line_),
+  PROTOBUF_FIELD_OFFSET(::config::CalendarConfig, _impl_.rgb_holiday_),
+  PROTOBUF_FIELD_OFFSET(::config::CalendarConfig, _impl_.bottom_left_label_),
+  PROTOBUF_FIELD_OFFSET(::config::CalendarConfig, _impl_.bottom_right_label_),
+  PROTOBUF_FIELD_OFFSET(::config::CalendarConfig, _impl_.header_font_family_),
+  PROTOBUF_FIELD_OFFSET(::config::CalendarConfig, _impl_.number_font_family_),
+  PROTOBUF_FIELD_OFFSET(::config::CalendarConfig, _impl_.quote_font_family_),
+  PROTOBUF_FIELD_OFFSET(::config::CalendarConfig, _impl_.dotted_line_),
+  PROTOBUF_FIELD_OFFSET(::config::CalendarConfig, _impl_.vertical_dotted_line_x_),
+  PROTOBUF_FIELD_OFFSET(::config::CalendarConfig, _impl_.output_type_),
+  PROTOBUF_FIELD_OFFSET(::config::CalendarConfig, _impl_.holiday_),
+  PROTOBUF_FIELD_OFFSET(::config::CalendarConfig, _impl_.output_types_),
+  PROTOBUF_FIELD_OFFSET(::config::CalendarConfig, _impl_.output_name_),
+  PROTOBUF_FIELD_OFFSET(::config::CalendarConfig, _impl_.render_threads_),
+  PROTOBUF_FIELD_OFFSET(::config::CalendarConfig, _impl_.tile_height_),
+  PROTOBUF_FIELD_OFFSET(::config::CalendarConfig, _impl_.start_year_),
+  PROTOBUF_FIELD_OFFSET(::config::CalendarConfig, _impl_.share_svg_paths_),
+  23,
+  24,
+  25,
+  ~0u,
+  10,
+  11,
+  12,
+  13,
+  14,
+  15,
+  16,
+  6,
+  7,
+  8,
+  9,
+  0,
+  1,
+  2,
+  3,
+  4,
+  18,
+  17,
+  19,
+  ~0u,
+  ~0u,
+  5,
+  26,
+  20,
+  21,
+  22,
+  PROTOBUF_FIELD_OFFSET(::config::SpecialDay, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::config::SpecialDay, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::config::SpecialDay, _impl_.month_),
+  PROTOBUF_FIELD_OFFSET(::config::SpecialDay, _impl_.day_),
+  PROTOBUF_FIELD_OFFSET(::config::SpecialDay, _impl_.svg_),
+  PROTOBUF_FIELD_OFFSET(::config::SpecialDay, _impl_.first_year_),
+  PROTOBUF_FIELD_OFFSET(::config::SpecialDay, _impl_.year_),
+  PROTOBUF_FIELD_OFFSET(::config::SpecialDay, _impl_.rgb_),
+  2,
+  3,
+  0,
+  4,
+  5,
+  1,
+  PROTOBUF_FIELD_OFFSET(::config::RGB, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::config::RGB, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::config::RGB, _impl_.red_),
+  PROTOBUF_FIELD_OFFSET(::config::RGB, _impl_.green_),
+  PROTOBUF_FIELD_OFFSET(::config::RGB, _impl_.blue_),
+  0,
+  1,
+  2,
+  PROTOBUF_FIELD_OFFSET(::config::HolidayRule, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::config::HolidayRule, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::config::HolidayRule, _impl_.name_),
+  PROTOBUF_FIELD_OFFSET(::config::HolidayRule, _impl_.month_),
+  PROTOBUF_FIELD_OFFSET(::config::HolidayRule, _impl_.day_),
+  PROTOBUF_FIELD_OFFSET(::config::HolidayRule, _impl_.wday_),
+  PROTOBUF_FIELD_OFFSET(::config::HolidayRule, _impl_.week_),
+  PROTOBUF_FIELD_OFFSET(::config::HolidayRule, _impl_.saturday_to_friday_),
+  PROTOBUF_FIELD_OFFSET(::config::HolidayRule, _impl_.sunday_to_monday_),
+  0,
+  1,
+  2,
+  3,
+  4,
+  5,
+  6,
+  PROTOBUF_FIELD_OFFSET(::config::CalendarBatch, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::config::CalendarBatch, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::config::CalendarBatch, _impl_.config_file_),
+  PROTOBUF_FIELD_OFFSET(::config::CalendarBatch, _impl_.config_),
+  PROTOBUF_FIELD_OFFSET(::config::CalendarBatch, _impl_.jobs_),
+  ~0u,
+  ~0u,
+  0,
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, 36, -1, sizeof(::config::CalendarConfig)},
+  { 66, 78, -1, sizeof(::config::SpecialDay)},
+  { 84, 93, -1, sizeof(::config::RGB)},
+  { 96, 109, -1, sizeof(::config::HolidayRule)},
+  { 116, 125, -1, sizeof(::config::CalendarBatch)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::config::_CalendarConfig_default_instance_._instance,
+  &::config::_SpecialDay_default_instance_._instance,
+  &::config::_RGB_default_instance_._instance,
+  &::config::_HolidayRule_default_instance_._instance,
+  &::config::_CalendarBatch_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_config_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\014config.proto\022\006config\"\364\006\n\016CalendarConfi"
+  "g\022\025\n\tnum_years\030\001 \001(\005:\00230\022\026\n\013first_month\030"
+  "\002 \001(\005:\0011\022\026\n\nnum_months\030\003 \001(\005:\00212\022\'\n\013spec"
+  "ial_day\030\004 \003(\0132\022.config.SpecialDay\022\021\n\tcel"
+  "l_size\030\005 \001(\001\022\023\n\013cell_margin\030\006 \001(\001\022\021\n\tfon"
+  "t_size\030\007 \001(\001\022\030\n\020bigger_font_size\030\010 \001(\001\022\022"
+  "\n\nline_width\030\t \001(\001\022\032\n\022month_label_height"
+  "\030\n \001(\001\022\030\n\020year_label_width\030\013 \001(\001\022\037\n\nrgb_"
+  "header\030\014 \001(\0132\013.config.RGB\022&\n\021rgb_header_"
+  "sunday\030\r \001(\0132\013.config.RGB\022#\n\016rgb_month_l"
+  "ine\030\016 \001(\0132\013.config.RGB\022 \n\013rgb_holiday\030\017 "
+  "\001(\0132\013.config.RGB\022\031\n\021bottom_left_label\030\020 "
+  "\001(\t\022\032\n\022bottom_right_label\030\021 \001(\t\022\032\n\022heade"
+  "r_font_family\030\022 \001(\t\022\032\n\022number_font_famil"
+  "y\030\023 \001(\t\022\031\n\021quote_font_family\030\024 \001(\t\022\032\n\013do"
+  "tted_line\030\025 \001(\010:\005false\022\036\n\026vertical_dotte"
+  "d_line_x\030\026 \001(\001\022,\n\013output_type\030\027 \001(\0162\022.co"
+  "nfig.OutputType:\003SVG\022$\n\007holiday\030\030 \003(\0132\023."
+  "config.HolidayRule\022(\n\014output_types\030\031 \003(\016"
+  "2\022.config.OutputType\022\034\n\013output_name\030\032 \001("
+  "\t:\007example\022\031\n\016render_threads\030\033 \001(\005:\0011\022\023\n"
+  "\013tile_height\030\034 \001(\005\022\022\n\nstart_year\030\035 \001(\005\022\035"
+  "\n\017share_svg_paths\030\036 \001(\010:\004true\"q\n\nSpecial"
+  "Day\022\r\n\005month\030\001 \002(\005\022\013\n\003day\030\002 \002(\005\022\013\n\003svg\030\003"
+  " \001(\t\022\022\n\nfirst_year\030\004 \001(\005\022\014\n\004year\030\005 \001(\005\022\030"
+  "\n\003rgb\030\006 \001(\0132\013.config.RGB\"/\n\003RGB\022\013\n\003red\030\001"
+  " \002(\005\022\r\n\005green\030\002 \002(\005\022\014\n\004blue\030\003 \002(\005\"\227\001\n\013Ho"
+  "lidayRule\022\014\n\004name\030\001 \001(\t\022\r\n\005month\030\002 \002(\005\022\013"
+  "\n\003day\030\003 \001(\005\022\014\n\004wday\030\004 \001(\005\022\014\n\004week\030\005 \001(\005\022"
+  "!\n\022saturday_to_friday\030\006 \001(\010:\005false\022\037\n\020su"
+  "nday_to_monday\030\007 \001(\010:\005false\"]\n\rCalendarB"
+  "atch\022\023\n\013config_file\030\001 \003(\t\022&\n\006config\030\002 \003("
+  "\0132\026.config.CalendarConfig\022\017\n\004jobs\030\003 \001(\005:"
+  "\0011*\'\n\nOutputType\022\007\n\003SVG\020\000\022\007\n\003PDF\020\001\022\007\n\003PN"
+  "G\020\002"
+  ;
+static ::_pbi::once_flag descriptor_table_config_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_config_2eproto = {
+    false, false, 1363, descriptor_table_protodef_config_2eproto,
+    "config.proto",
+    &descriptor_table_config_2eproto_once, nullptr, 0, 5,
+    schemas, file_default_instances, TableStruct_config_2eproto::offsets,
+    file_level_metadata_config_2eproto, file_level_enum_descriptors_config_2eproto,
+    file_level_service_descriptors_config_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_config_2eproto_getter() {
+  return &descriptor_table_config_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_config_2eproto(&descriptor_table_config_2eproto);
+namespace config {
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* OutputType_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_config_2eproto);
+  return file_level_enum_descriptors_config_2eproto[0];
 }
 bool OutputType_IsValid(int value) {
-  switch(value) {
+  switch (value) {
     case 0:
     case 1:
     case 2:
@@ -215,1176 +357,1270 @@ bool OutputType_IsValid(int value) {
 
 // ===================================================================
 
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int CalendarConfig::kNumYearsFieldNumber;
-const int CalendarConfig::kFirstMonthFieldNumber;
-const int CalendarConfig::kNumMonthsFieldNumber;
-const int CalendarConfig::kSpecialDayFieldNumber;
-const int CalendarConfig::kCellSizeFieldNumber;
-const int CalendarConfig::kCellMarginFieldNumber;
-const int CalendarConfig::kFontSizeFieldNumber;
-const int CalendarConfig::kBiggerFontSizeFieldNumber;
-const int CalendarConfig::kLineWidthFieldNumber;
-const int CalendarConfig::kMonthLabelHeightFieldNumber;
-const int CalendarConfig::kYearLabelWidthFieldNumber;
-const int CalendarConfig::kRgbHeaderFieldNumber;
-const int CalendarConfig::kRgbHeaderSundayFieldNumber;
-const int CalendarConfig::kRgbMonthLineFieldNumber;
-const int CalendarConfig::kRgbHolidayFieldNumber;
-const int CalendarConfig::kBottomLeftLabelFieldNumber;
-const int CalendarConfig::kBottomRightLabelFieldNumber;
-const int CalendarConfig::kHeaderFontFamilyFieldNumber;
-const int CalendarConfig::kNumberFontFamilyFieldNumber;
-const int CalendarConfig::kQuoteFontFamilyFieldNumber;
-const int CalendarConfig::kDottedLineFieldNumber;
-const int CalendarConfig::kVerticalDottedLineXFieldNumber;
-const int CalendarConfig::kOutputTypeFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
-
-CalendarConfig::CalendarConfig()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:config.CalendarConfig)
-}
-
-void CalendarConfig::InitAsDefaultInstance() {
-  rgb_header_ = const_cast< ::config::RGB*>(&::config::RGB::default_instance());
-  rgb_header_sunday_ = const_cast< ::config::RGB*>(&::config::RGB::default_instance());
-  rgb_month_line_ = const_cast< ::config::RGB*>(&::config::RGB::default_instance());
-  rgb_holiday_ = const_cast< ::config::RGB*>(&::config::RGB::default_instance());
-}
+class CalendarConfig::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CalendarConfig>()._impl_._has_bits_);
+  static void set_has_num_years(HasBits* has_bits) {
+    (*has_bits)[0] |= 8388608u;
+  }
+  static void set_has_first_month(HasBits* has_bits) {
+    (*has_bits)[0] |= 16777216u;
+  }
+  static void set_has_num_months(HasBits* has_bits) {
+    (*has_bits)[0] |= 33554432u;
+  }
+  static void set_has_cell_size(HasBits* has_bits) {
+    (*has_bits)[0] |= 1024u;
+  }
+  static void set_has_cell_margin(HasBits* has_bits) {
+    (*has_bits)[0] |= 2048u;
+  }
+  static void set_has_font_size(HasBits* has_bits) {
+    (*has_bits)[0] |= 4096u;
+  }
+  static void set_has_bigger_font_size(HasBits* has_bits) {
+    (*has_bits)[0] |= 8192u;
+  }
+  static void set_has_line_width(HasBits* has_bits) {
+    (*has_bits)[0] |= 16384u;
+  }
+  static void set_has_month_label_height(HasBits* has_bits) {
+    (*has_bits)[0] |= 32768u;
+  }
+  static void set_has_year_label_width(HasBits* has_bits) {
+    (*has_bits)[0] |= 65536u;
+  }
+  static const ::config::RGB& rgb_header(const CalendarConfig* msg);
+  static void set_has_rgb_header(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+  static const ::config::RGB& rgb_header_sunday(const CalendarConfig* msg);
+  static void set_has_rgb_header_sunday(HasBits* has_bits) {
+    (*has_bits)[0] |= 128u;
+  }
+  static const ::config::RGB& rgb_month_line(const CalendarConfig* msg);
+  static void set_has_rgb_month_line(HasBits* has_bits) {
+    (*has_bits)[0] |= 256u;
+  }
+  static const ::config::RGB& rgb_holiday(const CalendarConfig* msg);
+  static void set_has_rgb_holiday(HasBits* has_bits) {
+    (*has_bits)[0] |= 512u;
+  }
+  static void set_has_bottom_left_label(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_bottom_right_label(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_header_font_family(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_number_font_family(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_quote_font_family(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_dotted_line(HasBits* has_bits) {
+    (*has_bits)[0] |= 262144u;
+  }
+  static void set_has_vertical_dotted_line_x(HasBits* has_bits) {
+    (*has_bits)[0] |= 131072u;
+  }
+  static void set_has_output_type(HasBits* has_bits) {
+    (*has_bits)[0] |= 524288u;
+  }
+  static void set_has_output_name(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static void set_has_render_threads(HasBits* has_bits) {
+    (*has_bits)[0] |= 67108864u;
+  }
+  static void set_has_tile_height(HasBits* has_bits) {
+    (*has_bits)[0] |= 1048576u;
+  }
+  static void set_has_start_year(HasBits* has_bits) {
+    (*has_bits)[0] |= 2097152u;
+  }
+  static void set_has_share_svg_paths(HasBits* has_bits) {
+    (*has_bits)[0] |= 4194304u;
+  }
+};
 
+const ::config::RGB&
+CalendarConfig::_Internal::rgb_header(const CalendarConfig* msg) {
+  return *msg->_impl_.rgb_header_;
+}
+const ::config::RGB&
+CalendarConfig::_Internal::rgb_header_sunday(const CalendarConfig* msg) {
+  return *msg->_impl_.rgb_header_sunday_;
+}
+const ::config::RGB&
+CalendarConfig::_Internal::rgb_month_line(const CalendarConfig* msg) {
+  return *msg->_impl_.rgb_month_line_;
+}
+const ::config::RGB&
+CalendarConfig::_Internal::rgb_holiday(const CalendarConfig* msg) {
+  return *msg->_impl_.rgb_holiday_;
+}
+const ::PROTOBUF_NAMESPACE_ID::internal::LazyString CalendarConfig::Impl_::_i_give_permission_to_break_this_code_default_output_name_{{{"example", 7}}, {nullptr}};
+CalendarConfig::CalendarConfig(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:config.CalendarConfig)
+}
 CalendarConfig::CalendarConfig(const CalendarConfig& from)
-  : ::google::protobuf::Message(),
-    _internal_metadata_(NULL) {
-  SharedCtor();
-  MergeFrom(from);
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CalendarConfig* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.special_day_){from._impl_.special_day_}
+    , decltype(_impl_.holiday_){from._impl_.holiday_}
+    , decltype(_impl_.output_types_){from._impl_.output_types_}
+    , decltype(_impl_.bottom_left_label_){}
+    , decltype(_impl_.bottom_right_label_){}
+    , decltype(_impl_.header_font_family_){}
+    , decltype(_impl_.number_font_family_){}
+    , decltype(_impl_.quote_font_family_){}
+    , decltype(_impl_.output_name_){}
+    , decltype(_impl_.rgb_header_){nullptr}
+    , decltype(_impl_.rgb_header_sunday_){nullptr}
+    , decltype(_impl_.rgb_month_line_){nullptr}
+    , decltype(_impl_.rgb_holiday_){nullptr}
+    , decltype(_impl_.cell_size_){}
+    , decltype(_impl_.cell_margin_){}
+    , decltype(_impl_.font_size_){}
+    , decltype(_impl_.bigger_font_size_){}
+    , decltype(_impl_.line_width_){}
+    , decltype(_impl_.month_label_height_){}
+    , decltype(_impl_.year_label_width_){}
+    , decltype(_impl_.vertical_dotted_line_x_){}
+    , decltype(_impl_.dotted_line_){}
+    , decltype(_impl_.output_type_){}
+    , decltype(_impl_.tile_height_){}
+    , decltype(_impl_.start_year_){}
+    , decltype(_impl_.share_svg_paths_){}
+    , decltype(_impl_.num_years_){}
+    , decltype(_impl_.first_month_){}
+    , decltype(_impl_.num_months_){}
+    , decltype(_impl_.render_threads_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.bottom_left_label_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.bottom_left_label_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_bottom_left_label()) {
+    _this->_impl_.bottom_left_label_.Set(from._internal_bottom_left_label(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.bottom_right_label_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.bottom_right_label_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_bottom_right_label()) {
+    _this->_impl_.bottom_right_label_.Set(from._internal_bottom_right_label(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.header_font_family_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.header_font_family_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_header_font_family()) {
+    _this->_impl_.header_font_family_.Set(from._internal_header_font_family(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.number_font_family_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.number_font_family_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_number_font_family()) {
+    _this->_impl_.number_font_family_.Set(from._internal_number_font_family(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.quote_font_family_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.quote_font_family_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_quote_font_family()) {
+    _this->_impl_.quote_font_family_.Set(from._internal_quote_font_family(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.output_name_.InitDefault();
+  if (from._internal_has_output_name()) {
+    _this->_impl_.output_name_.Set(from._internal_output_name(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_rgb_header()) {
+    _this->_impl_.rgb_header_ = new ::config::RGB(*from._impl_.rgb_header_);
+  }
+  if (from._internal_has_rgb_header_sunday()) {
+    _this->_impl_.rgb_header_sunday_ = new ::config::RGB(*from._impl_.rgb_header_sunday_);
+  }
+  if (from._internal_has_rgb_month_line()) {
+    _this->_impl_.rgb_month_line_ = new ::config::RGB(*from._impl_.rgb_month_line_);
+  }
+  if (from._internal_has_rgb_holiday()) {
+    _this->_impl_.rgb_holiday_ = new ::config::RGB(*from._impl_.rgb_holiday_);
+  }
+  ::memcpy(&_impl_.cell_size_, &from._impl_.cell_size_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.render_threads_) -
+    reinterpret_cast<char*>(&_impl_.cell_size_)) + sizeof(_impl_.render_threads_));
   // @@protoc_insertion_point(copy_constructor:config.CalendarConfig)
 }
 
-void CalendarConfig::SharedCtor() {
-  ::google::protobuf::internal::GetEmptyString();
-  _cached_size_ = 0;
-  num_years_ = 30;
-  first_month_ = 1;
-  num_months_ = 12;
-  cell_size_ = 0;
-  cell_margin_ = 0;
-  font_size_ = 0;
-  bigger_font_size_ = 0;
-  line_width_ = 0;
-  month_label_height_ = 0;
-  year_label_width_ = 0;
-  rgb_header_ = NULL;
-  rgb_header_sunday_ = NULL;
-  rgb_month_line_ = NULL;
-  rgb_holiday_ = NULL;
-  bottom_left_label_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  bottom_right_label_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  header_font_family_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  number_font_family_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  quote_font_family_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  dotted_line_ = false;
-  vertical_dotted_line_x_ = 0;
-  output_type_ = 0;
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+inline void CalendarConfig::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.special_day_){arena}
+    , decltype(_impl_.holiday_){arena}
+    , decltype(_impl_.output_types_){arena}
+    , decltype(_impl_.bottom_left_label_){}
+    , decltype(_impl_.bottom_right_label_){}
+    , decltype(_impl_.header_font_family_){}
+    , decltype(_impl_.number_font_family_){}
+    , decltype(_impl_.quote_font_family_){}
+    , decltype(_impl_.output_name_){}
+    , decltype(_impl_.rgb_header_){nullptr}
+    , decltype(_impl_.rgb_header_sunday_){nullptr}
+    , decltype(_impl_.rgb_month_line_){nullptr}
+    , decltype(_impl_.rgb_holiday_){nullptr}
+    , decltype(_impl_.cell_size_){0}
+    , decltype(_impl_.cell_margin_){0}
+    , decltype(_impl_.font_size_){0}
+    , decltype(_impl_.bigger_font_size_){0}
+    , decltype(_impl_.line_width_){0}
+    , decltype(_impl_.month_label_height_){0}
+    , decltype(_impl_.year_label_width_){0}
+    , decltype(_impl_.vertical_dotted_line_x_){0}
+    , decltype(_impl_.dotted_line_){false}
+    , decltype(_impl_.output_type_){0}
+    , decltype(_impl_.tile_height_){0}
+    , decltype(_impl_.start_year_){0}
+    , decltype(_impl_.share_svg_paths_){true}
+    , decltype(_impl_.num_years_){30}
+    , decltype(_impl_.first_month_){1}
+    , decltype(_impl_.num_months_){12}
+    , decltype(_impl_.render_threads_){1}
+  };
+  _impl_.bottom_left_label_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.bottom_left_label_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.bottom_right_label_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.bottom_right_label_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.header_font_family_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.header_font_family_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.number_font_family_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.number_font_family_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.quote_font_family_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.quote_font_family_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.output_name_.InitDefault();
 }
 
 CalendarConfig::~CalendarConfig() {
   // @@protoc_insertion_point(destructor:config.CalendarConfig)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void CalendarConfig::SharedDtor() {
-  bottom_left_label_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  bottom_right_label_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  header_font_family_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  number_font_family_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  quote_font_family_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (this != default_instance_) {
-    delete rgb_header_;
-    delete rgb_header_sunday_;
-    delete rgb_month_line_;
-    delete rgb_holiday_;
-  }
+inline void CalendarConfig::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.special_day_.~RepeatedPtrField();
+  _impl_.holiday_.~RepeatedPtrField();
+  _impl_.output_types_.~RepeatedField();
+  _impl_.bottom_left_label_.Destroy();
+  _impl_.bottom_right_label_.Destroy();
+  _impl_.header_font_family_.Destroy();
+  _impl_.number_font_family_.Destroy();
+  _impl_.quote_font_family_.Destroy();
+  _impl_.output_name_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.rgb_header_;
+  if (this != internal_default_instance()) delete _impl_.rgb_header_sunday_;
+  if (this != internal_default_instance()) delete _impl_.rgb_month_line_;
+  if (this != internal_default_instance()) delete _impl_.rgb_holiday_;
 }
 
 void CalendarConfig::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* CalendarConfig::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return CalendarConfig_descriptor_;
-}
-
-const CalendarConfig& CalendarConfig::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_config_2eproto();
-  return *default_instance_;
-}
-
-CalendarConfig* CalendarConfig::default_instance_ = NULL;
-
-CalendarConfig* CalendarConfig::New(::google::protobuf::Arena* arena) const {
-  CalendarConfig* n = new CalendarConfig;
-  if (arena != NULL) {
-    arena->Own(n);
-  }
-  return n;
+  _impl_._cached_size_.Set(size);
 }
 
 void CalendarConfig::Clear() {
 // @@protoc_insertion_point(message_clear_start:config.CalendarConfig)
-#if defined(__clang__)
-#define ZR_HELPER_(f) \
-  _Pragma("clang diagnostic push") \
-  _Pragma("clang diagnostic ignored \"-Winvalid-offsetof\"") \
-  __builtin_offsetof(CalendarConfig, f) \
-  _Pragma("clang diagnostic pop")
-#else
-#define ZR_HELPER_(f) reinterpret_cast<char*>(\
-  &reinterpret_cast<CalendarConfig*>(16)->f)
-#endif
-
-#define ZR_(first, last) do {\
-  ::memset(&first, 0,\
-           ZR_HELPER_(last) - ZR_HELPER_(first) + sizeof(last));\
-} while (0)
-
-  if (_has_bits_[0 / 32] & 247u) {
-    ZR_(cell_size_, bigger_font_size_);
-    num_years_ = 30;
-    first_month_ = 1;
-    num_months_ = 12;
-  }
-  if (_has_bits_[8 / 32] & 65280u) {
-    ZR_(line_width_, year_label_width_);
-    if (has_rgb_header()) {
-      if (rgb_header_ != NULL) rgb_header_->::config::RGB::Clear();
-    }
-    if (has_rgb_header_sunday()) {
-      if (rgb_header_sunday_ != NULL) rgb_header_sunday_->::config::RGB::Clear();
-    }
-    if (has_rgb_month_line()) {
-      if (rgb_month_line_ != NULL) rgb_month_line_->::config::RGB::Clear();
-    }
-    if (has_rgb_holiday()) {
-      if (rgb_holiday_ != NULL) rgb_holiday_->::config::RGB::Clear();
-    }
-    if (has_bottom_left_label()) {
-      bottom_left_label_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-    }
-  }
-  if (_has_bits_[16 / 32] & 8323072u) {
-    ZR_(vertical_dotted_line_x_, output_type_);
-    if (has_bottom_right_label()) {
-      bottom_right_label_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-    }
-    if (has_header_font_family()) {
-      header_font_family_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-    }
-    if (has_number_font_family()) {
-      number_font_family_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-    }
-    if (has_quote_font_family()) {
-      quote_font_family_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-    }
-    dotted_line_ = false;
-  }
-
-#undef ZR_HELPER_
-#undef ZR_
-
-  special_day_.Clear();
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  if (_internal_metadata_.have_unknown_fields()) {
-    mutable_unknown_fields()->Clear();
-  }
-}
-
-bool CalendarConfig::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:config.CalendarConfig)
-  for (;;) {
-    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoff(16383);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.special_day_.Clear();
+  _impl_.holiday_.Clear();
+  _impl_.output_types_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.bottom_left_label_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.bottom_right_label_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _impl_.header_font_family_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _impl_.number_font_family_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _impl_.quote_font_family_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _impl_.output_name_.ClearToDefault(::config::CalendarConfig::Impl_::_i_give_permission_to_break_this_code_default_output_name_, GetArenaForAllocation());
+       }
+    if (cached_has_bits & 0x00000040u) {
+      GOOGLE_DCHECK(_impl_.rgb_header_ != nullptr);
+      _impl_.rgb_header_->Clear();
+    }
+    if (cached_has_bits & 0x00000080u) {
+      GOOGLE_DCHECK(_impl_.rgb_header_sunday_ != nullptr);
+      _impl_.rgb_header_sunday_->Clear();
+    }
+  }
+  if (cached_has_bits & 0x00000300u) {
+    if (cached_has_bits & 0x00000100u) {
+      GOOGLE_DCHECK(_impl_.rgb_month_line_ != nullptr);
+      _impl_.rgb_month_line_->Clear();
+    }
+    if (cached_has_bits & 0x00000200u) {
+      GOOGLE_DCHECK(_impl_.rgb_holiday_ != nullptr);
+      _impl_.rgb_holiday_->Clear();
+    }
+  }
+  if (cached_has_bits & 0x0000fc00u) {
+    ::memset(&_impl_.cell_size_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.month_label_height_) -
+        reinterpret_cast<char*>(&_impl_.cell_size_)) + sizeof(_impl_.month_label_height_));
+  }
+  if (cached_has_bits & 0x00ff0000u) {
+    ::memset(&_impl_.year_label_width_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.start_year_) -
+        reinterpret_cast<char*>(&_impl_.year_label_width_)) + sizeof(_impl_.start_year_));
+    _impl_.share_svg_paths_ = true;
+    _impl_.num_years_ = 30;
+  }
+  if (cached_has_bits & 0x07000000u) {
+    _impl_.first_month_ = 1;
+    _impl_.num_months_ = 12;
+    _impl_.render_threads_ = 1;
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CalendarConfig::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // optional int32 num_years = 1 [default = 30];
-      case 1: {
-        if (tag == 8) {
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 input, &num_years_)));
-          set_has_num_years();
-        } else {
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_num_years(&has_bits);
+          _impl_.num_years_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectTag(16)) goto parse_first_month;
-        break;
-      }
-
+        continue;
       // optional int32 first_month = 2 [default = 1];
-      case 2: {
-        if (tag == 16) {
-         parse_first_month:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 input, &first_month_)));
-          set_has_first_month();
-        } else {
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_first_month(&has_bits);
+          _impl_.first_month_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectTag(24)) goto parse_num_months;
-        break;
-      }
-
+        continue;
       // optional int32 num_months = 3 [default = 12];
-      case 3: {
-        if (tag == 24) {
-         parse_num_months:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 input, &num_months_)));
-          set_has_num_months();
-        } else {
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_num_months(&has_bits);
+          _impl_.num_months_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectTag(34)) goto parse_special_day;
-        break;
-      }
-
+        continue;
       // repeated .config.SpecialDay special_day = 4;
-      case 4: {
-        if (tag == 34) {
-         parse_special_day:
-          DO_(input->IncrementRecursionDepth());
-         parse_loop_special_day:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtualNoRecursionDepth(
-                input, add_special_day()));
-        } else {
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_special_day(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<34>(ptr));
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectTag(34)) goto parse_loop_special_day;
-        input->UnsafeDecrementRecursionDepth();
-        if (input->ExpectTag(41)) goto parse_cell_size;
-        break;
-      }
-
+        continue;
       // optional double cell_size = 5;
-      case 5: {
-        if (tag == 41) {
-         parse_cell_size:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   double, ::google::protobuf::internal::WireFormatLite::TYPE_DOUBLE>(
-                 input, &cell_size_)));
-          set_has_cell_size();
-        } else {
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 41)) {
+          _Internal::set_has_cell_size(&has_bits);
+          _impl_.cell_size_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectTag(49)) goto parse_cell_margin;
-        break;
-      }
-
+        continue;
       // optional double cell_margin = 6;
-      case 6: {
-        if (tag == 49) {
-         parse_cell_margin:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   double, ::google::protobuf::internal::WireFormatLite::TYPE_DOUBLE>(
-                 input, &cell_margin_)));
-          set_has_cell_margin();
-        } else {
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 49)) {
+          _Internal::set_has_cell_margin(&has_bits);
+          _impl_.cell_margin_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectTag(57)) goto parse_font_size;
-        break;
-      }
-
+        continue;
       // optional double font_size = 7;
-      case 7: {
-        if (tag == 57) {
-         parse_font_size:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   double, ::google::protobuf::internal::WireFormatLite::TYPE_DOUBLE>(
-                 input, &font_size_)));
-          set_has_font_size();
-        } else {
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 57)) {
+          _Internal::set_has_font_size(&has_bits);
+          _impl_.font_size_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectTag(65)) goto parse_bigger_font_size;
-        break;
-      }
-
+        continue;
       // optional double bigger_font_size = 8;
-      case 8: {
-        if (tag == 65) {
-         parse_bigger_font_size:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   double, ::google::protobuf::internal::WireFormatLite::TYPE_DOUBLE>(
-                 input, &bigger_font_size_)));
-          set_has_bigger_font_size();
-        } else {
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 65)) {
+          _Internal::set_has_bigger_font_size(&has_bits);
+          _impl_.bigger_font_size_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectTag(73)) goto parse_line_width;
-        break;
-      }
-
+        continue;
       // optional double line_width = 9;
-      case 9: {
-        if (tag == 73) {
-         parse_line_width:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   double, ::google::protobuf::internal::WireFormatLite::TYPE_DOUBLE>(
-                 input, &line_width_)));
-          set_has_line_width();
-        } else {
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 73)) {
+          _Internal::set_has_line_width(&has_bits);
+          _impl_.line_width_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectTag(81)) goto parse_month_label_height;
-        break;
-      }
-
+        continue;
       // optional double month_label_height = 10;
-      case 10: {
-        if (tag == 81) {
-         parse_month_label_height:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   double, ::google::protobuf::internal::WireFormatLite::TYPE_DOUBLE>(
-                 input, &month_label_height_)));
-          set_has_month_label_height();
-        } else {
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 81)) {
+          _Internal::set_has_month_label_height(&has_bits);
+          _impl_.month_label_height_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectTag(89)) goto parse_year_label_width;
-        break;
-      }
-
+        continue;
       // optional double year_label_width = 11;
-      case 11: {
-        if (tag == 89) {
-         parse_year_label_width:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   double, ::google::protobuf::internal::WireFormatLite::TYPE_DOUBLE>(
-                 input, &year_label_width_)));
-          set_has_year_label_width();
-        } else {
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 89)) {
+          _Internal::set_has_year_label_width(&has_bits);
+          _impl_.year_label_width_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectTag(98)) goto parse_rgb_header;
-        break;
-      }
-
+        continue;
       // optional .config.RGB rgb_header = 12;
-      case 12: {
-        if (tag == 98) {
-         parse_rgb_header:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_rgb_header()));
-        } else {
+      case 12:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 98)) {
+          ptr = ctx->ParseMessage(_internal_mutable_rgb_header(), ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectTag(106)) goto parse_rgb_header_sunday;
-        break;
-      }
-
+        continue;
       // optional .config.RGB rgb_header_sunday = 13;
-      case 13: {
-        if (tag == 106) {
-         parse_rgb_header_sunday:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_rgb_header_sunday()));
-        } else {
+      case 13:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 106)) {
+          ptr = ctx->ParseMessage(_internal_mutable_rgb_header_sunday(), ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectTag(114)) goto parse_rgb_month_line;
-        break;
-      }
-
+        continue;
       // optional .config.RGB rgb_month_line = 14;
-      case 14: {
-        if (tag == 114) {
-         parse_rgb_month_line:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_rgb_month_line()));
-        } else {
+      case 14:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 114)) {
+          ptr = ctx->ParseMessage(_internal_mutable_rgb_month_line(), ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectTag(122)) goto parse_rgb_holiday;
-        break;
-      }
-
+        continue;
       // optional .config.RGB rgb_holiday = 15;
-      case 15: {
-        if (tag == 122) {
-         parse_rgb_holiday:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_rgb_holiday()));
-        } else {
+      case 15:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 122)) {
+          ptr = ctx->ParseMessage(_internal_mutable_rgb_holiday(), ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectTag(130)) goto parse_bottom_left_label;
-        break;
-      }
-
+        continue;
       // optional string bottom_left_label = 16;
-      case 16: {
-        if (tag == 130) {
-         parse_bottom_left_label:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_bottom_left_label()));
-          ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
-            this->bottom_left_label().data(), this->bottom_left_label().length(),
-            ::google::protobuf::internal::WireFormat::PARSE,
-            "config.CalendarConfig.bottom_left_label");
-        } else {
+      case 16:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 130)) {
+          auto str = _internal_mutable_bottom_left_label();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "config.CalendarConfig.bottom_left_label");
+          #endif  // !NDEBUG
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectTag(138)) goto parse_bottom_right_label;
-        break;
-      }
-
+        continue;
       // optional string bottom_right_label = 17;
-      case 17: {
-        if (tag == 138) {
-         parse_bottom_right_label:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_bottom_right_label()));
-          ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
-            this->bottom_right_label().data(), this->bottom_right_label().length(),
-            ::google::protobuf::internal::WireFormat::PARSE,
-            "config.CalendarConfig.bottom_right_label");
-        } else {
+      case 17:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 138)) {
+          auto str = _internal_mutable_bottom_right_label();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "config.CalendarConfig.bottom_right_label");
+          #endif  // !NDEBUG
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectTag(146)) goto parse_header_font_family;
-        break;
-      }
-
+        continue;
       // optional string header_font_family = 18;
-      case 18: {
-        if (tag == 146) {
-         parse_header_font_family:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_header_font_family()));
-          ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
-            this->header_font_family().data(), this->header_font_family().length(),
-            ::google::protobuf::internal::WireFormat::PARSE,
-            "config.CalendarConfig.header_font_family");
-        } else {
+      case 18:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 146)) {
+          auto str = _internal_mutable_header_font_family();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "config.CalendarConfig.header_font_family");
+          #endif  // !NDEBUG
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectTag(154)) goto parse_number_font_family;
-        break;
-      }
-
+        continue;
       // optional string number_font_family = 19;
-      case 19: {
-        if (tag == 154) {
-         parse_number_font_family:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_number_font_family()));
-          ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
-            this->number_font_family().data(), this->number_font_family().length(),
-            ::google::protobuf::internal::WireFormat::PARSE,
-            "config.CalendarConfig.number_font_family");
-        } else {
+      case 19:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 154)) {
+          auto str = _internal_mutable_number_font_family();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "config.CalendarConfig.number_font_family");
+          #endif  // !NDEBUG
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectTag(162)) goto parse_quote_font_family;
-        break;
-      }
-
+        continue;
       // optional string quote_font_family = 20;
-      case 20: {
-        if (tag == 162) {
-         parse_quote_font_family:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_quote_font_family()));
-          ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
-            this->quote_font_family().data(), this->quote_font_family().length(),
-            ::google::protobuf::internal::WireFormat::PARSE,
-            "config.CalendarConfig.quote_font_family");
-        } else {
+      case 20:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 162)) {
+          auto str = _internal_mutable_quote_font_family();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "config.CalendarConfig.quote_font_family");
+          #endif  // !NDEBUG
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectTag(168)) goto parse_dotted_line;
-        break;
-      }
-
+        continue;
       // optional bool dotted_line = 21 [default = false];
-      case 21: {
-        if (tag == 168) {
-         parse_dotted_line:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
-                 input, &dotted_line_)));
-          set_has_dotted_line();
-        } else {
+      case 21:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 168)) {
+          _Internal::set_has_dotted_line(&has_bits);
+          _impl_.dotted_line_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectTag(177)) goto parse_vertical_dotted_line_x;
-        break;
-      }
-
+        continue;
       // optional double vertical_dotted_line_x = 22;
-      case 22: {
-        if (tag == 177) {
-         parse_vertical_dotted_line_x:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   double, ::google::protobuf::internal::WireFormatLite::TYPE_DOUBLE>(
-                 input, &vertical_dotted_line_x_)));
-          set_has_vertical_dotted_line_x();
-        } else {
+      case 22:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 177)) {
+          _Internal::set_has_vertical_dotted_line_x(&has_bits);
+          _impl_.vertical_dotted_line_x_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectTag(184)) goto parse_output_type;
-        break;
-      }
-
+        continue;
       // optional .config.OutputType output_type = 23 [default = SVG];
-      case 23: {
-        if (tag == 184) {
-         parse_output_type:
-          int value;
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   int, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>(
-                 input, &value)));
-          if (::config::OutputType_IsValid(value)) {
-            set_output_type(static_cast< ::config::OutputType >(value));
+      case 23:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 184)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::config::OutputType_IsValid(val))) {
+            _internal_set_output_type(static_cast<::config::OutputType>(val));
           } else {
-            mutable_unknown_fields()->AddVarint(23, value);
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(23, val, mutable_unknown_fields());
           }
-        } else {
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectAtEnd()) goto success;
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0 ||
-            ::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
-    }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:config.CalendarConfig)
-  return true;
+        continue;
+      // repeated .config.HolidayRule holiday = 24;
+      case 24:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 194)) {
+          ptr -= 2;
+          do {
+            ptr += 2;
+            ptr = ctx->ParseMessage(_internal_add_holiday(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<194>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .config.OutputType output_types = 25;
+      case 25:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 200)) {
+          ptr -= 2;
+          do {
+            ptr += 2;
+            uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+            CHK_(ptr);
+            if (PROTOBUF_PREDICT_TRUE(::config::OutputType_IsValid(val))) {
+              _internal_add_output_types(static_cast<::config::OutputType>(val));
+            } else {
+              ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(25, val, mutable_unknown_fields());
+            }
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<200>(ptr));
+        } else if (static_cast<uint8_t>(tag) == 202) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedEnumParser<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(_internal_mutable_output_types(), ptr, ctx, ::config::OutputType_IsValid, &_internal_metadata_, 25);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string output_name = 26 [default = "example"];
+      case 26:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 210)) {
+          auto str = _internal_mutable_output_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "config.CalendarConfig.output_name");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 render_threads = 27 [default = 1];
+      case 27:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 216)) {
+          _Internal::set_has_render_threads(&has_bits);
+          _impl_.render_threads_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 tile_height = 28;
+      case 28:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 224)) {
+          _Internal::set_has_tile_height(&has_bits);
+          _impl_.tile_height_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 start_year = 29;
+      case 29:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 232)) {
+          _Internal::set_has_start_year(&has_bits);
+          _impl_.start_year_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool share_svg_paths = 30 [default = true];
+      case 30:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 240)) {
+          _Internal::set_has_share_svg_paths(&has_bits);
+          _impl_.share_svg_paths_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:config.CalendarConfig)
-  return false;
-#undef DO_
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-void CalendarConfig::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:config.CalendarConfig)
+uint8_t* CalendarConfig::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:config.CalendarConfig)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
   // optional int32 num_years = 1 [default = 30];
-  if (has_num_years()) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt32(1, this->num_years(), output);
+  if (cached_has_bits & 0x00800000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_num_years(), target);
   }
 
   // optional int32 first_month = 2 [default = 1];
-  if (has_first_month()) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt32(2, this->first_month(), output);
+  if (cached_has_bits & 0x01000000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_first_month(), target);
   }
 
   // optional int32 num_months = 3 [default = 12];
-  if (has_num_months()) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt32(3, this->num_months(), output);
+  if (cached_has_bits & 0x02000000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_num_months(), target);
   }
 
   // repeated .config.SpecialDay special_day = 4;
-  for (unsigned int i = 0, n = this->special_day_size(); i < n; i++) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      4, this->special_day(i), output);
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_special_day_size()); i < n; i++) {
+    const auto& repfield = this->_internal_special_day(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(4, repfield, repfield.GetCachedSize(), target, stream);
   }
 
   // optional double cell_size = 5;
-  if (has_cell_size()) {
-    ::google::protobuf::internal::WireFormatLite::WriteDouble(5, this->cell_size(), output);
+  if (cached_has_bits & 0x00000400u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(5, this->_internal_cell_size(), target);
   }
 
   // optional double cell_margin = 6;
-  if (has_cell_margin()) {
-    ::google::protobuf::internal::WireFormatLite::WriteDouble(6, this->cell_margin(), output);
+  if (cached_has_bits & 0x00000800u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(6, this->_internal_cell_margin(), target);
   }
 
   // optional double font_size = 7;
-  if (has_font_size()) {
-    ::google::protobuf::internal::WireFormatLite::WriteDouble(7, this->font_size(), output);
+  if (cached_has_bits & 0x00001000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(7, this->_internal_font_size(), target);
   }
 
   // optional double bigger_font_size = 8;
-  if (has_bigger_font_size()) {
-    ::google::protobuf::internal::WireFormatLite::WriteDouble(8, this->bigger_font_size(), output);
+  if (cached_has_bits & 0x00002000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(8, this->_internal_bigger_font_size(), target);
   }
 
   // optional double line_width = 9;
-  if (has_line_width()) {
-    ::google::protobuf::internal::WireFormatLite::WriteDouble(9, this->line_width(), output);
+  if (cached_has_bits & 0x00004000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(9, this->_internal_line_width(), target);
   }
 
   // optional double month_label_height = 10;
-  if (has_month_label_height()) {
-    ::google::protobuf::internal::WireFormatLite::WriteDouble(10, this->month_label_height(), output);
+  if (cached_has_bits & 0x00008000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(10, this->_internal_month_label_height(), target);
   }
 
   // optional double year_label_width = 11;
-  if (has_year_label_width()) {
-    ::google::protobuf::internal::WireFormatLite::WriteDouble(11, this->year_label_width(), output);
+  if (cached_has_bits & 0x00010000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(11, this->_internal_year_label_width(), target);
   }
 
   // optional .config.RGB rgb_header = 12;
-  if (has_rgb_header()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      12, *this->rgb_header_, output);
+  if (cached_has_bits & 0x00000040u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(12, _Internal::rgb_header(this),
+        _Internal::rgb_header(this).GetCachedSize(), target, stream);
   }
 
   // optional .config.RGB rgb_header_sunday = 13;
-  if (has_rgb_header_sunday()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      13, *this->rgb_header_sunday_, output);
+  if (cached_has_bits & 0x00000080u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(13, _Internal::rgb_header_sunday(this),
+        _Internal::rgb_header_sunday(this).GetCachedSize(), target, stream);
   }
 
   // optional .config.RGB rgb_month_line = 14;
-  if (has_rgb_month_line()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      14, *this->rgb_month_line_, output);
+  if (cached_has_bits & 0x00000100u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(14, _Internal::rgb_month_line(this),
+        _Internal::rgb_month_line(this).GetCachedSize(), target, stream);
   }
 
   // optional .config.RGB rgb_holiday = 15;
-  if (has_rgb_holiday()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      15, *this->rgb_holiday_, output);
+  if (cached_has_bits & 0x00000200u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(15, _Internal::rgb_holiday(this),
+        _Internal::rgb_holiday(this).GetCachedSize(), target, stream);
   }
 
   // optional string bottom_left_label = 16;
-  if (has_bottom_left_label()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
-      this->bottom_left_label().data(), this->bottom_left_label().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE,
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_bottom_left_label().data(), static_cast<int>(this->_internal_bottom_left_label().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
       "config.CalendarConfig.bottom_left_label");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      16, this->bottom_left_label(), output);
+    target = stream->WriteStringMaybeAliased(
+        16, this->_internal_bottom_left_label(), target);
   }
 
   // optional string bottom_right_label = 17;
-  if (has_bottom_right_label()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
-      this->bottom_right_label().data(), this->bottom_right_label().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE,
+  if (cached_has_bits & 0x00000002u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_bottom_right_label().data(), static_cast<int>(this->_internal_bottom_right_label().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
       "config.CalendarConfig.bottom_right_label");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      17, this->bottom_right_label(), output);
+    target = stream->WriteStringMaybeAliased(
+        17, this->_internal_bottom_right_label(), target);
   }
 
   // optional string header_font_family = 18;
-  if (has_header_font_family()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
-      this->header_font_family().data(), this->header_font_family().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE,
+  if (cached_has_bits & 0x00000004u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_header_font_family().data(), static_cast<int>(this->_internal_header_font_family().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
       "config.CalendarConfig.header_font_family");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      18, this->header_font_family(), output);
+    target = stream->WriteStringMaybeAliased(
+        18, this->_internal_header_font_family(), target);
   }
 
   // optional string number_font_family = 19;
-  if (has_number_font_family()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
-      this->number_font_family().data(), this->number_font_family().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE,
+  if (cached_has_bits & 0x00000008u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_number_font_family().data(), static_cast<int>(this->_internal_number_font_family().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
       "config.CalendarConfig.number_font_family");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      19, this->number_font_family(), output);
+    target = stream->WriteStringMaybeAliased(
+        19, this->_internal_number_font_family(), target);
   }
 
   // optional string quote_font_family = 20;
-  if (has_quote_font_family()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
-      this->quote_font_family().data(), this->quote_font_family().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE,
+  if (cached_has_bits & 0x00000010u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_quote_font_family().data(), static_cast<int>(this->_internal_quote_font_family().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
       "config.CalendarConfig.quote_font_family");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      20, this->quote_font_family(), output);
+    target = stream->WriteStringMaybeAliased(
+        20, this->_internal_quote_font_family(), target);
   }
 
   // optional bool dotted_line = 21 [default = false];
-  if (has_dotted_line()) {
-    ::google::protobuf::internal::WireFormatLite::WriteBool(21, this->dotted_line(), output);
+  if (cached_has_bits & 0x00040000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(21, this->_internal_dotted_line(), target);
   }
 
   // optional double vertical_dotted_line_x = 22;
-  if (has_vertical_dotted_line_x()) {
-    ::google::protobuf::internal::WireFormatLite::WriteDouble(22, this->vertical_dotted_line_x(), output);
+  if (cached_has_bits & 0x00020000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(22, this->_internal_vertical_dotted_line_x(), target);
   }
 
   // optional .config.OutputType output_type = 23 [default = SVG];
-  if (has_output_type()) {
-    ::google::protobuf::internal::WireFormatLite::WriteEnum(
-      23, this->output_type(), output);
-  }
-
-  if (_internal_metadata_.have_unknown_fields()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
-  }
-  // @@protoc_insertion_point(serialize_end:config.CalendarConfig)
-}
-
-::google::protobuf::uint8* CalendarConfig::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
-  // @@protoc_insertion_point(serialize_to_array_start:config.CalendarConfig)
-  // optional int32 num_years = 1 [default = 30];
-  if (has_num_years()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(1, this->num_years(), target);
-  }
-
-  // optional int32 first_month = 2 [default = 1];
-  if (has_first_month()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(2, this->first_month(), target);
+  if (cached_has_bits & 0x00080000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      23, this->_internal_output_type(), target);
   }
 
-  // optional int32 num_months = 3 [default = 12];
-  if (has_num_months()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(3, this->num_months(), target);
-  }
-
-  // repeated .config.SpecialDay special_day = 4;
-  for (unsigned int i = 0, n = this->special_day_size(); i < n; i++) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      InternalWriteMessageNoVirtualToArray(
-        4, this->special_day(i), false, target);
-  }
-
-  // optional double cell_size = 5;
-  if (has_cell_size()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteDoubleToArray(5, this->cell_size(), target);
-  }
-
-  // optional double cell_margin = 6;
-  if (has_cell_margin()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteDoubleToArray(6, this->cell_margin(), target);
+  // repeated .config.HolidayRule holiday = 24;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_holiday_size()); i < n; i++) {
+    const auto& repfield = this->_internal_holiday(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(24, repfield, repfield.GetCachedSize(), target, stream);
   }
 
-  // optional double font_size = 7;
-  if (has_font_size()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteDoubleToArray(7, this->font_size(), target);
+  // repeated .config.OutputType output_types = 25;
+  for (int i = 0, n = this->_internal_output_types_size(); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+        25, this->_internal_output_types(i), target);
   }
 
-  // optional double bigger_font_size = 8;
-  if (has_bigger_font_size()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteDoubleToArray(8, this->bigger_font_size(), target);
+  // optional string output_name = 26 [default = "example"];
+  if (cached_has_bits & 0x00000020u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_output_name().data(), static_cast<int>(this->_internal_output_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "config.CalendarConfig.output_name");
+    target = stream->WriteStringMaybeAliased(
+        26, this->_internal_output_name(), target);
   }
 
-  // optional double line_width = 9;
-  if (has_line_width()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteDoubleToArray(9, this->line_width(), target);
+  // optional int32 render_threads = 27 [default = 1];
+  if (cached_has_bits & 0x04000000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(27, this->_internal_render_threads(), target);
   }
 
-  // optional double month_label_height = 10;
-  if (has_month_label_height()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteDoubleToArray(10, this->month_label_height(), target);
+  // optional int32 tile_height = 28;
+  if (cached_has_bits & 0x00100000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(28, this->_internal_tile_height(), target);
   }
 
-  // optional double year_label_width = 11;
-  if (has_year_label_width()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteDoubleToArray(11, this->year_label_width(), target);
+  // optional int32 start_year = 29;
+  if (cached_has_bits & 0x00200000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(29, this->_internal_start_year(), target);
   }
 
-  // optional .config.RGB rgb_header = 12;
-  if (has_rgb_header()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      InternalWriteMessageNoVirtualToArray(
-        12, *this->rgb_header_, false, target);
+  // optional bool share_svg_paths = 30 [default = true];
+  if (cached_has_bits & 0x00400000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(30, this->_internal_share_svg_paths(), target);
   }
 
-  // optional .config.RGB rgb_header_sunday = 13;
-  if (has_rgb_header_sunday()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      InternalWriteMessageNoVirtualToArray(
-        13, *this->rgb_header_sunday_, false, target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
+  // @@protoc_insertion_point(serialize_to_array_end:config.CalendarConfig)
+  return target;
+}
 
-  // optional .config.RGB rgb_month_line = 14;
-  if (has_rgb_month_line()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      InternalWriteMessageNoVirtualToArray(
-        14, *this->rgb_month_line_, false, target);
-  }
+size_t CalendarConfig::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:config.CalendarConfig)
+  size_t total_size = 0;
 
-  // optional .config.RGB rgb_holiday = 15;
-  if (has_rgb_holiday()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      InternalWriteMessageNoVirtualToArray(
-        15, *this->rgb_holiday_, false, target);
-  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
-  // optional string bottom_left_label = 16;
-  if (has_bottom_left_label()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
-      this->bottom_left_label().data(), this->bottom_left_label().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE,
-      "config.CalendarConfig.bottom_left_label");
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        16, this->bottom_left_label(), target);
+  // repeated .config.SpecialDay special_day = 4;
+  total_size += 1UL * this->_internal_special_day_size();
+  for (const auto& msg : this->_impl_.special_day_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
-  // optional string bottom_right_label = 17;
-  if (has_bottom_right_label()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
-      this->bottom_right_label().data(), this->bottom_right_label().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE,
-      "config.CalendarConfig.bottom_right_label");
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        17, this->bottom_right_label(), target);
+  // repeated .config.HolidayRule holiday = 24;
+  total_size += 2UL * this->_internal_holiday_size();
+  for (const auto& msg : this->_impl_.holiday_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
-  // optional string header_font_family = 18;
-  if (has_header_font_family()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
-      this->header_font_family().data(), this->header_font_family().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE,
-      "config.CalendarConfig.header_font_family");
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        18, this->header_font_family(), target);
+  // repeated .config.OutputType output_types = 25;
+  {
+    size_t data_size = 0;
+    unsigned int count = static_cast<unsigned int>(this->_internal_output_types_size());for (unsigned int i = 0; i < count; i++) {
+      data_size += ::_pbi::WireFormatLite::EnumSize(
+        this->_internal_output_types(static_cast<int>(i)));
+    }
+    total_size += (2UL * count) + data_size;
   }
 
-  // optional string number_font_family = 19;
-  if (has_number_font_family()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
-      this->number_font_family().data(), this->number_font_family().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE,
-      "config.CalendarConfig.number_font_family");
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        19, this->number_font_family(), target);
-  }
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    // optional string bottom_left_label = 16;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_bottom_left_label());
+    }
 
-  // optional string quote_font_family = 20;
-  if (has_quote_font_family()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
-      this->quote_font_family().data(), this->quote_font_family().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE,
-      "config.CalendarConfig.quote_font_family");
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        20, this->quote_font_family(), target);
-  }
+    // optional string bottom_right_label = 17;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_bottom_right_label());
+    }
 
-  // optional bool dotted_line = 21 [default = false];
-  if (has_dotted_line()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(21, this->dotted_line(), target);
-  }
+    // optional string header_font_family = 18;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_header_font_family());
+    }
 
-  // optional double vertical_dotted_line_x = 22;
-  if (has_vertical_dotted_line_x()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteDoubleToArray(22, this->vertical_dotted_line_x(), target);
-  }
+    // optional string number_font_family = 19;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_number_font_family());
+    }
 
-  // optional .config.OutputType output_type = 23 [default = SVG];
-  if (has_output_type()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteEnumToArray(
-      23, this->output_type(), target);
-  }
+    // optional string quote_font_family = 20;
+    if (cached_has_bits & 0x00000010u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_quote_font_family());
+    }
 
-  if (_internal_metadata_.have_unknown_fields()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
-  }
-  // @@protoc_insertion_point(serialize_to_array_end:config.CalendarConfig)
-  return target;
-}
+    // optional string output_name = 26 [default = "example"];
+    if (cached_has_bits & 0x00000020u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_output_name());
+    }
 
-int CalendarConfig::ByteSize() const {
-// @@protoc_insertion_point(message_byte_size_start:config.CalendarConfig)
-  int total_size = 0;
+    // optional .config.RGB rgb_header = 12;
+    if (cached_has_bits & 0x00000040u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.rgb_header_);
+    }
 
-  if (_has_bits_[0 / 32] & 247u) {
-    // optional int32 num_years = 1 [default = 30];
-    if (has_num_years()) {
+    // optional .config.RGB rgb_header_sunday = 13;
+    if (cached_has_bits & 0x00000080u) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::Int32Size(
-          this->num_years());
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.rgb_header_sunday_);
     }
 
-    // optional int32 first_month = 2 [default = 1];
-    if (has_first_month()) {
+  }
+  if (cached_has_bits & 0x0000ff00u) {
+    // optional .config.RGB rgb_month_line = 14;
+    if (cached_has_bits & 0x00000100u) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::Int32Size(
-          this->first_month());
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.rgb_month_line_);
     }
 
-    // optional int32 num_months = 3 [default = 12];
-    if (has_num_months()) {
+    // optional .config.RGB rgb_holiday = 15;
+    if (cached_has_bits & 0x00000200u) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::Int32Size(
-          this->num_months());
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.rgb_holiday_);
     }
 
     // optional double cell_size = 5;
-    if (has_cell_size()) {
+    if (cached_has_bits & 0x00000400u) {
       total_size += 1 + 8;
     }
 
     // optional double cell_margin = 6;
-    if (has_cell_margin()) {
+    if (cached_has_bits & 0x00000800u) {
       total_size += 1 + 8;
     }
 
     // optional double font_size = 7;
-    if (has_font_size()) {
+    if (cached_has_bits & 0x00001000u) {
       total_size += 1 + 8;
     }
 
     // optional double bigger_font_size = 8;
-    if (has_bigger_font_size()) {
+    if (cached_has_bits & 0x00002000u) {
       total_size += 1 + 8;
     }
 
-  }
-  if (_has_bits_[8 / 32] & 65280u) {
     // optional double line_width = 9;
-    if (has_line_width()) {
+    if (cached_has_bits & 0x00004000u) {
       total_size += 1 + 8;
     }
 
     // optional double month_label_height = 10;
-    if (has_month_label_height()) {
+    if (cached_has_bits & 0x00008000u) {
       total_size += 1 + 8;
     }
 
+  }
+  if (cached_has_bits & 0x00ff0000u) {
     // optional double year_label_width = 11;
-    if (has_year_label_width()) {
+    if (cached_has_bits & 0x00010000u) {
       total_size += 1 + 8;
     }
 
-    // optional .config.RGB rgb_header = 12;
-    if (has_rgb_header()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          *this->rgb_header_);
-    }
-
-    // optional .config.RGB rgb_header_sunday = 13;
-    if (has_rgb_header_sunday()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          *this->rgb_header_sunday_);
-    }
-
-    // optional .config.RGB rgb_month_line = 14;
-    if (has_rgb_month_line()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          *this->rgb_month_line_);
+    // optional double vertical_dotted_line_x = 22;
+    if (cached_has_bits & 0x00020000u) {
+      total_size += 2 + 8;
     }
 
-    // optional .config.RGB rgb_holiday = 15;
-    if (has_rgb_holiday()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          *this->rgb_holiday_);
+    // optional bool dotted_line = 21 [default = false];
+    if (cached_has_bits & 0x00040000u) {
+      total_size += 2 + 1;
     }
 
-    // optional string bottom_left_label = 16;
-    if (has_bottom_left_label()) {
+    // optional .config.OutputType output_type = 23 [default = SVG];
+    if (cached_has_bits & 0x00080000u) {
       total_size += 2 +
-        ::google::protobuf::internal::WireFormatLite::StringSize(
-          this->bottom_left_label());
+        ::_pbi::WireFormatLite::EnumSize(this->_internal_output_type());
     }
 
-  }
-  if (_has_bits_[16 / 32] & 8323072u) {
-    // optional string bottom_right_label = 17;
-    if (has_bottom_right_label()) {
+    // optional int32 tile_height = 28;
+    if (cached_has_bits & 0x00100000u) {
       total_size += 2 +
-        ::google::protobuf::internal::WireFormatLite::StringSize(
-          this->bottom_right_label());
+        ::_pbi::WireFormatLite::Int32Size(
+          this->_internal_tile_height());
     }
 
-    // optional string header_font_family = 18;
-    if (has_header_font_family()) {
+    // optional int32 start_year = 29;
+    if (cached_has_bits & 0x00200000u) {
       total_size += 2 +
-        ::google::protobuf::internal::WireFormatLite::StringSize(
-          this->header_font_family());
+        ::_pbi::WireFormatLite::Int32Size(
+          this->_internal_start_year());
     }
 
-    // optional string number_font_family = 19;
-    if (has_number_font_family()) {
-      total_size += 2 +
-        ::google::protobuf::internal::WireFormatLite::StringSize(
-          this->number_font_family());
+    // optional bool share_svg_paths = 30 [default = true];
+    if (cached_has_bits & 0x00400000u) {
+      total_size += 2 + 1;
     }
 
-    // optional string quote_font_family = 20;
-    if (has_quote_font_family()) {
-      total_size += 2 +
-        ::google::protobuf::internal::WireFormatLite::StringSize(
-          this->quote_font_family());
+    // optional int32 num_years = 1 [default = 30];
+    if (cached_has_bits & 0x00800000u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_num_years());
     }
 
-    // optional bool dotted_line = 21 [default = false];
-    if (has_dotted_line()) {
-      total_size += 2 + 1;
+  }
+  if (cached_has_bits & 0x07000000u) {
+    // optional int32 first_month = 2 [default = 1];
+    if (cached_has_bits & 0x01000000u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_first_month());
     }
 
-    // optional double vertical_dotted_line_x = 22;
-    if (has_vertical_dotted_line_x()) {
-      total_size += 2 + 8;
+    // optional int32 num_months = 3 [default = 12];
+    if (cached_has_bits & 0x02000000u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_num_months());
     }
 
-    // optional .config.OutputType output_type = 23 [default = SVG];
-    if (has_output_type()) {
+    // optional int32 render_threads = 27 [default = 1];
+    if (cached_has_bits & 0x04000000u) {
       total_size += 2 +
-        ::google::protobuf::internal::WireFormatLite::EnumSize(this->output_type());
+        ::_pbi::WireFormatLite::Int32Size(
+          this->_internal_render_threads());
     }
 
   }
-  // repeated .config.SpecialDay special_day = 4;
-  total_size += 1 * this->special_day_size();
-  for (int i = 0; i < this->special_day_size(); i++) {
-    total_size +=
-      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-        this->special_day(i));
-  }
-
-  if (_internal_metadata_.have_unknown_fields()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
-  }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void CalendarConfig::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:config.CalendarConfig)
-  if (GOOGLE_PREDICT_FALSE(&from == this)) {
-    ::google::protobuf::internal::MergeFromFail(__FILE__, __LINE__);
-  }
-  const CalendarConfig* source = 
-      ::google::protobuf::internal::DynamicCastToGenerated<const CalendarConfig>(
-          &from);
-  if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:config.CalendarConfig)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:config.CalendarConfig)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CalendarConfig::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CalendarConfig::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CalendarConfig::GetClassData() const { return &_class_data_; }
 
-void CalendarConfig::MergeFrom(const CalendarConfig& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:config.CalendarConfig)
-  if (GOOGLE_PREDICT_FALSE(&from == this)) {
-    ::google::protobuf::internal::MergeFromFail(__FILE__, __LINE__);
-  }
-  special_day_.MergeFrom(from.special_day_);
-  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_num_years()) {
-      set_num_years(from.num_years());
+
+void CalendarConfig::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CalendarConfig*>(&to_msg);
+  auto& from = static_cast<const CalendarConfig&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:config.CalendarConfig)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.special_day_.MergeFrom(from._impl_.special_day_);
+  _this->_impl_.holiday_.MergeFrom(from._impl_.holiday_);
+  _this->_impl_.output_types_.MergeFrom(from._impl_.output_types_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_bottom_left_label(from._internal_bottom_left_label());
     }
-    if (from.has_first_month()) {
-      set_first_month(from.first_month());
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_bottom_right_label(from._internal_bottom_right_label());
     }
-    if (from.has_num_months()) {
-      set_num_months(from.num_months());
+    if (cached_has_bits & 0x00000004u) {
+      _this->_internal_set_header_font_family(from._internal_header_font_family());
     }
-    if (from.has_cell_size()) {
-      set_cell_size(from.cell_size());
+    if (cached_has_bits & 0x00000008u) {
+      _this->_internal_set_number_font_family(from._internal_number_font_family());
     }
-    if (from.has_cell_margin()) {
-      set_cell_margin(from.cell_margin());
+    if (cached_has_bits & 0x00000010u) {
+      _this->_internal_set_quote_font_family(from._internal_quote_font_family());
     }
-    if (from.has_font_size()) {
-      set_font_size(from.font_size());
+    if (cached_has_bits & 0x00000020u) {
+      _this->_internal_set_output_name(from._internal_output_name());
     }
-    if (from.has_bigger_font_size()) {
-      set_bigger_font_size(from.bigger_font_size());
+    if (cached_has_bits & 0x00000040u) {
+      _this->_internal_mutable_rgb_header()->::config::RGB::MergeFrom(
+          from._internal_rgb_header());
+    }
+    if (cached_has_bits & 0x00000080u) {
+      _this->_internal_mutable_rgb_header_sunday()->::config::RGB::MergeFrom(
+          from._internal_rgb_header_sunday());
     }
   }
-  if (from._has_bits_[8 / 32] & (0xffu << (8 % 32))) {
-    if (from.has_line_width()) {
-      set_line_width(from.line_width());
+  if (cached_has_bits & 0x0000ff00u) {
+    if (cached_has_bits & 0x00000100u) {
+      _this->_internal_mutable_rgb_month_line()->::config::RGB::MergeFrom(
+          from._internal_rgb_month_line());
     }
-    if (from.has_month_label_height()) {
-      set_month_label_height(from.month_label_height());
+    if (cached_has_bits & 0x00000200u) {
+      _this->_internal_mutable_rgb_holiday()->::config::RGB::MergeFrom(
+          from._internal_rgb_holiday());
     }
-    if (from.has_year_label_width()) {
-      set_year_label_width(from.year_label_width());
+    if (cached_has_bits & 0x00000400u) {
+      _this->_impl_.cell_size_ = from._impl_.cell_size_;
     }
-    if (from.has_rgb_header()) {
-      mutable_rgb_header()->::config::RGB::MergeFrom(from.rgb_header());
+    if (cached_has_bits & 0x00000800u) {
+      _this->_impl_.cell_margin_ = from._impl_.cell_margin_;
     }
-    if (from.has_rgb_header_sunday()) {
-      mutable_rgb_header_sunday()->::config::RGB::MergeFrom(from.rgb_header_sunday());
+    if (cached_has_bits & 0x00001000u) {
+      _this->_impl_.font_size_ = from._impl_.font_size_;
     }
-    if (from.has_rgb_month_line()) {
-      mutable_rgb_month_line()->::config::RGB::MergeFrom(from.rgb_month_line());
+    if (cached_has_bits & 0x00002000u) {
+      _this->_impl_.bigger_font_size_ = from._impl_.bigger_font_size_;
     }
-    if (from.has_rgb_holiday()) {
-      mutable_rgb_holiday()->::config::RGB::MergeFrom(from.rgb_holiday());
+    if (cached_has_bits & 0x00004000u) {
+      _this->_impl_.line_width_ = from._impl_.line_width_;
     }
-    if (from.has_bottom_left_label()) {
-      set_has_bottom_left_label();
-      bottom_left_label_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.bottom_left_label_);
+    if (cached_has_bits & 0x00008000u) {
+      _this->_impl_.month_label_height_ = from._impl_.month_label_height_;
     }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
   }
-  if (from._has_bits_[16 / 32] & (0xffu << (16 % 32))) {
-    if (from.has_bottom_right_label()) {
-      set_has_bottom_right_label();
-      bottom_right_label_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.bottom_right_label_);
+  if (cached_has_bits & 0x00ff0000u) {
+    if (cached_has_bits & 0x00010000u) {
+      _this->_impl_.year_label_width_ = from._impl_.year_label_width_;
+    }
+    if (cached_has_bits & 0x00020000u) {
+      _this->_impl_.vertical_dotted_line_x_ = from._impl_.vertical_dotted_line_x_;
     }
-    if (from.has_header_font_family()) {
-      set_has_header_font_family();
-      header_font_family_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.header_font_family_);
+    if (cached_has_bits & 0x00040000u) {
+      _this->_impl_.dotted_line_ = from._impl_.dotted_line_;
     }
-    if (from.has_number_font_family()) {
-      set_has_number_font_family();
-      number_font_family_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.number_font_family_);
+    if (cached_has_bits & 0x00080000u) {
+      _this->_impl_.output_type_ = from._impl_.output_type_;
     }
-    if (from.has_quote_font_family()) {
-      set_has_quote_font_family();
-      quote_font_family_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.quote_font_family_);
+    if (cached_has_bits & 0x00100000u) {
+      _this->_impl_.tile_height_ = from._impl_.tile_height_;
     }
-    if (from.has_dotted_line()) {
-      set_dotted_line(from.dotted_line());
+    if (cached_has_bits & 0x00200000u) {
+      _this->_impl_.start_year_ = from._impl_.start_year_;
     }
-    if (from.has_vertical_dotted_line_x()) {
-      set_vertical_dotted_line_x(from.vertical_dotted_line_x());
+    if (cached_has_bits & 0x00400000u) {
+      _this->_impl_.share_svg_paths_ = from._impl_.share_svg_paths_;
     }
-    if (from.has_output_type()) {
-      set_output_type(from.output_type());
+    if (cached_has_bits & 0x00800000u) {
+      _this->_impl_.num_years_ = from._impl_.num_years_;
     }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
   }
-  if (from._internal_metadata_.have_unknown_fields()) {
-    mutable_unknown_fields()->MergeFrom(from.unknown_fields());
+  if (cached_has_bits & 0x07000000u) {
+    if (cached_has_bits & 0x01000000u) {
+      _this->_impl_.first_month_ = from._impl_.first_month_;
+    }
+    if (cached_has_bits & 0x02000000u) {
+      _this->_impl_.num_months_ = from._impl_.num_months_;
+    }
+    if (cached_has_bits & 0x04000000u) {
+      _this->_impl_.render_threads_ = from._impl_.render_threads_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
   }
-}
-
-void CalendarConfig::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:config.CalendarConfig)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void CalendarConfig::CopyFrom(const CalendarConfig& from) {
@@ -1395,1322 +1631,459 @@ void CalendarConfig::CopyFrom(const CalendarConfig& from) {
 }
 
 bool CalendarConfig::IsInitialized() const {
-
-  if (!::google::protobuf::internal::AllAreInitialized(this->special_day())) return false;
-  if (has_rgb_header()) {
-    if (!this->rgb_header_->IsInitialized()) return false;
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(_impl_.special_day_))
+    return false;
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(_impl_.holiday_))
+    return false;
+  if (_internal_has_rgb_header()) {
+    if (!_impl_.rgb_header_->IsInitialized()) return false;
   }
-  if (has_rgb_header_sunday()) {
-    if (!this->rgb_header_sunday_->IsInitialized()) return false;
+  if (_internal_has_rgb_header_sunday()) {
+    if (!_impl_.rgb_header_sunday_->IsInitialized()) return false;
   }
-  if (has_rgb_month_line()) {
-    if (!this->rgb_month_line_->IsInitialized()) return false;
+  if (_internal_has_rgb_month_line()) {
+    if (!_impl_.rgb_month_line_->IsInitialized()) return false;
   }
-  if (has_rgb_holiday()) {
-    if (!this->rgb_holiday_->IsInitialized()) return false;
+  if (_internal_has_rgb_holiday()) {
+    if (!_impl_.rgb_holiday_->IsInitialized()) return false;
   }
   return true;
 }
 
-void CalendarConfig::Swap(CalendarConfig* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void CalendarConfig::InternalSwap(CalendarConfig* other) {
-  std::swap(num_years_, other->num_years_);
-  std::swap(first_month_, other->first_month_);
-  std::swap(num_months_, other->num_months_);
-  special_day_.UnsafeArenaSwap(&other->special_day_);
-  std::swap(cell_size_, other->cell_size_);
-  std::swap(cell_margin_, other->cell_margin_);
-  std::swap(font_size_, other->font_size_);
-  std::swap(bigger_font_size_, other->bigger_font_size_);
-  std::swap(line_width_, other->line_width_);
-  std::swap(month_label_height_, other->month_label_height_);
-  std::swap(year_label_width_, other->year_label_width_);
-  std::swap(rgb_header_, other->rgb_header_);
-  std::swap(rgb_header_sunday_, other->rgb_header_sunday_);
-  std::swap(rgb_month_line_, other->rgb_month_line_);
-  std::swap(rgb_holiday_, other->rgb_holiday_);
-  bottom_left_label_.Swap(&other->bottom_left_label_);
-  bottom_right_label_.Swap(&other->bottom_right_label_);
-  header_font_family_.Swap(&other->header_font_family_);
-  number_font_family_.Swap(&other->number_font_family_);
-  quote_font_family_.Swap(&other->quote_font_family_);
-  std::swap(dotted_line_, other->dotted_line_);
-  std::swap(vertical_dotted_line_x_, other->vertical_dotted_line_x_);
-  std::swap(output_type_, other->output_type_);
-  std::swap(_has_bits_[0], other->_has_bits_[0]);
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  std::swap(_cached_size_, other->_cached_size_);
-}
-
-::google::protobuf::Metadata CalendarConfig::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = CalendarConfig_descriptor_;
-  metadata.reflection = CalendarConfig_reflection_;
-  return metadata;
-}
-
-#if PROTOBUF_INLINE_NOT_IN_HEADERS
-// CalendarConfig
-
-// optional int32 num_years = 1 [default = 30];
-bool CalendarConfig::has_num_years() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
-}
-void CalendarConfig::set_has_num_years() {
-  _has_bits_[0] |= 0x00000001u;
-}
-void CalendarConfig::clear_has_num_years() {
-  _has_bits_[0] &= ~0x00000001u;
-}
-void CalendarConfig::clear_num_years() {
-  num_years_ = 30;
-  clear_has_num_years();
-}
- ::google::protobuf::int32 CalendarConfig::num_years() const {
-  // @@protoc_insertion_point(field_get:config.CalendarConfig.num_years)
-  return num_years_;
-}
- void CalendarConfig::set_num_years(::google::protobuf::int32 value) {
-  set_has_num_years();
-  num_years_ = value;
-  // @@protoc_insertion_point(field_set:config.CalendarConfig.num_years)
-}
-
-// optional int32 first_month = 2 [default = 1];
-bool CalendarConfig::has_first_month() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
-}
-void CalendarConfig::set_has_first_month() {
-  _has_bits_[0] |= 0x00000002u;
-}
-void CalendarConfig::clear_has_first_month() {
-  _has_bits_[0] &= ~0x00000002u;
-}
-void CalendarConfig::clear_first_month() {
-  first_month_ = 1;
-  clear_has_first_month();
-}
- ::google::protobuf::int32 CalendarConfig::first_month() const {
-  // @@protoc_insertion_point(field_get:config.CalendarConfig.first_month)
-  return first_month_;
-}
- void CalendarConfig::set_first_month(::google::protobuf::int32 value) {
-  set_has_first_month();
-  first_month_ = value;
-  // @@protoc_insertion_point(field_set:config.CalendarConfig.first_month)
-}
-
-// optional int32 num_months = 3 [default = 12];
-bool CalendarConfig::has_num_months() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
-}
-void CalendarConfig::set_has_num_months() {
-  _has_bits_[0] |= 0x00000004u;
-}
-void CalendarConfig::clear_has_num_months() {
-  _has_bits_[0] &= ~0x00000004u;
-}
-void CalendarConfig::clear_num_months() {
-  num_months_ = 12;
-  clear_has_num_months();
-}
- ::google::protobuf::int32 CalendarConfig::num_months() const {
-  // @@protoc_insertion_point(field_get:config.CalendarConfig.num_months)
-  return num_months_;
-}
- void CalendarConfig::set_num_months(::google::protobuf::int32 value) {
-  set_has_num_months();
-  num_months_ = value;
-  // @@protoc_insertion_point(field_set:config.CalendarConfig.num_months)
-}
-
-// repeated .config.SpecialDay special_day = 4;
-int CalendarConfig::special_day_size() const {
-  return special_day_.size();
-}
-void CalendarConfig::clear_special_day() {
-  special_day_.Clear();
-}
-const ::config::SpecialDay& CalendarConfig::special_day(int index) const {
-  // @@protoc_insertion_point(field_get:config.CalendarConfig.special_day)
-  return special_day_.Get(index);
-}
-::config::SpecialDay* CalendarConfig::mutable_special_day(int index) {
-  // @@protoc_insertion_point(field_mutable:config.CalendarConfig.special_day)
-  return special_day_.Mutable(index);
-}
-::config::SpecialDay* CalendarConfig::add_special_day() {
-  // @@protoc_insertion_point(field_add:config.CalendarConfig.special_day)
-  return special_day_.Add();
-}
-::google::protobuf::RepeatedPtrField< ::config::SpecialDay >*
-CalendarConfig::mutable_special_day() {
-  // @@protoc_insertion_point(field_mutable_list:config.CalendarConfig.special_day)
-  return &special_day_;
-}
-const ::google::protobuf::RepeatedPtrField< ::config::SpecialDay >&
-CalendarConfig::special_day() const {
-  // @@protoc_insertion_point(field_list:config.CalendarConfig.special_day)
-  return special_day_;
-}
-
-// optional double cell_size = 5;
-bool CalendarConfig::has_cell_size() const {
-  return (_has_bits_[0] & 0x00000010u) != 0;
-}
-void CalendarConfig::set_has_cell_size() {
-  _has_bits_[0] |= 0x00000010u;
-}
-void CalendarConfig::clear_has_cell_size() {
-  _has_bits_[0] &= ~0x00000010u;
-}
-void CalendarConfig::clear_cell_size() {
-  cell_size_ = 0;
-  clear_has_cell_size();
-}
- double CalendarConfig::cell_size() const {
-  // @@protoc_insertion_point(field_get:config.CalendarConfig.cell_size)
-  return cell_size_;
-}
- void CalendarConfig::set_cell_size(double value) {
-  set_has_cell_size();
-  cell_size_ = value;
-  // @@protoc_insertion_point(field_set:config.CalendarConfig.cell_size)
-}
-
-// optional double cell_margin = 6;
-bool CalendarConfig::has_cell_margin() const {
-  return (_has_bits_[0] & 0x00000020u) != 0;
-}
-void CalendarConfig::set_has_cell_margin() {
-  _has_bits_[0] |= 0x00000020u;
-}
-void CalendarConfig::clear_has_cell_margin() {
-  _has_bits_[0] &= ~0x00000020u;
-}
-void CalendarConfig::clear_cell_margin() {
-  cell_margin_ = 0;
-  clear_has_cell_margin();
-}
- double CalendarConfig::cell_margin() const {
-  // @@protoc_insertion_point(field_get:config.CalendarConfig.cell_margin)
-  return cell_margin_;
-}
- void CalendarConfig::set_cell_margin(double value) {
-  set_has_cell_margin();
-  cell_margin_ = value;
-  // @@protoc_insertion_point(field_set:config.CalendarConfig.cell_margin)
-}
-
-// optional double font_size = 7;
-bool CalendarConfig::has_font_size() const {
-  return (_has_bits_[0] & 0x00000040u) != 0;
-}
-void CalendarConfig::set_has_font_size() {
-  _has_bits_[0] |= 0x00000040u;
-}
-void CalendarConfig::clear_has_font_size() {
-  _has_bits_[0] &= ~0x00000040u;
-}
-void CalendarConfig::clear_font_size() {
-  font_size_ = 0;
-  clear_has_font_size();
-}
- double CalendarConfig::font_size() const {
-  // @@protoc_insertion_point(field_get:config.CalendarConfig.font_size)
-  return font_size_;
-}
- void CalendarConfig::set_font_size(double value) {
-  set_has_font_size();
-  font_size_ = value;
-  // @@protoc_insertion_point(field_set:config.CalendarConfig.font_size)
-}
-
-// optional double bigger_font_size = 8;
-bool CalendarConfig::has_bigger_font_size() const {
-  return (_has_bits_[0] & 0x00000080u) != 0;
-}
-void CalendarConfig::set_has_bigger_font_size() {
-  _has_bits_[0] |= 0x00000080u;
-}
-void CalendarConfig::clear_has_bigger_font_size() {
-  _has_bits_[0] &= ~0x00000080u;
-}
-void CalendarConfig::clear_bigger_font_size() {
-  bigger_font_size_ = 0;
-  clear_has_bigger_font_size();
-}
- double CalendarConfig::bigger_font_size() const {
-  // @@protoc_insertion_point(field_get:config.CalendarConfig.bigger_font_size)
-  return bigger_font_size_;
-}
- void CalendarConfig::set_bigger_font_size(double value) {
-  set_has_bigger_font_size();
-  bigger_font_size_ = value;
-  // @@protoc_insertion_point(field_set:config.CalendarConfig.bigger_font_size)
-}
-
-// optional double line_width = 9;
-bool CalendarConfig::has_line_width() const {
-  return (_has_bits_[0] & 0x00000100u) != 0;
-}
-void CalendarConfig::set_has_line_width() {
-  _has_bits_[0] |= 0x00000100u;
-}
-void CalendarConfig::clear_has_line_width() {
-  _has_bits_[0] &= ~0x00000100u;
-}
-void CalendarConfig::clear_line_width() {
-  line_width_ = 0;
-  clear_has_line_width();
-}
- double CalendarConfig::line_width() const {
-  // @@protoc_insertion_point(field_get:config.CalendarConfig.line_width)
-  return line_width_;
-}
- void CalendarConfig::set_line_width(double value) {
-  set_has_line_width();
-  line_width_ = value;
-  // @@protoc_insertion_point(field_set:config.CalendarConfig.line_width)
-}
-
-// optional double month_label_height = 10;
-bool CalendarConfig::has_month_label_height() const {
-  return (_has_bits_[0] & 0x00000200u) != 0;
-}
-void CalendarConfig::set_has_month_label_height() {
-  _has_bits_[0] |= 0x00000200u;
-}
-void CalendarConfig::clear_has_month_label_height() {
-  _has_bits_[0] &= ~0x00000200u;
-}
-void CalendarConfig::clear_month_label_height() {
-  month_label_height_ = 0;
-  clear_has_month_label_height();
-}
- double CalendarConfig::month_label_height() const {
-  // @@protoc_insertion_point(field_get:config.CalendarConfig.month_label_height)
-  return month_label_height_;
-}
- void CalendarConfig::set_month_label_height(double value) {
-  set_has_month_label_height();
-  month_label_height_ = value;
-  // @@protoc_insertion_point(field_set:config.CalendarConfig.month_label_height)
-}
-
-// optional double year_label_width = 11;
-bool CalendarConfig::has_year_label_width() const {
-  return (_has_bits_[0] & 0x00000400u) != 0;
-}
-void CalendarConfig::set_has_year_label_width() {
-  _has_bits_[0] |= 0x00000400u;
-}
-void CalendarConfig::clear_has_year_label_width() {
-  _has_bits_[0] &= ~0x00000400u;
-}
-void CalendarConfig::clear_year_label_width() {
-  year_label_width_ = 0;
-  clear_has_year_label_width();
-}
- double CalendarConfig::year_label_width() const {
-  // @@protoc_insertion_point(field_get:config.CalendarConfig.year_label_width)
-  return year_label_width_;
-}
- void CalendarConfig::set_year_label_width(double value) {
-  set_has_year_label_width();
-  year_label_width_ = value;
-  // @@protoc_insertion_point(field_set:config.CalendarConfig.year_label_width)
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.special_day_.InternalSwap(&other->_impl_.special_day_);
+  _impl_.holiday_.InternalSwap(&other->_impl_.holiday_);
+  _impl_.output_types_.InternalSwap(&other->_impl_.output_types_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.bottom_left_label_, lhs_arena,
+      &other->_impl_.bottom_left_label_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.bottom_right_label_, lhs_arena,
+      &other->_impl_.bottom_right_label_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.header_font_family_, lhs_arena,
+      &other->_impl_.header_font_family_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.number_font_family_, lhs_arena,
+      &other->_impl_.number_font_family_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.quote_font_family_, lhs_arena,
+      &other->_impl_.quote_font_family_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.output_name_, lhs_arena,
+      &other->_impl_.output_name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(CalendarConfig, _impl_.start_year_)
+      + sizeof(CalendarConfig::_impl_.start_year_)
+      - PROTOBUF_FIELD_OFFSET(CalendarConfig, _impl_.rgb_header_)>(
+          reinterpret_cast<char*>(&_impl_.rgb_header_),
+          reinterpret_cast<char*>(&other->_impl_.rgb_header_));
+  swap(_impl_.share_svg_paths_, other->_impl_.share_svg_paths_);
+  swap(_impl_.num_years_, other->_impl_.num_years_);
+  swap(_impl_.first_month_, other->_impl_.first_month_);
+  swap(_impl_.num_months_, other->_impl_.num_months_);
+  swap(_impl_.render_threads_, other->_impl_.render_threads_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CalendarConfig::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_config_2eproto_getter, &descriptor_table_config_2eproto_once,
+      file_level_metadata_config_2eproto[0]);
 }
 
-// optional .config.RGB rgb_header = 12;
-bool CalendarConfig::has_rgb_header() const {
-  return (_has_bits_[0] & 0x00000800u) != 0;
-}
-void CalendarConfig::set_has_rgb_header() {
-  _has_bits_[0] |= 0x00000800u;
-}
-void CalendarConfig::clear_has_rgb_header() {
-  _has_bits_[0] &= ~0x00000800u;
-}
-void CalendarConfig::clear_rgb_header() {
-  if (rgb_header_ != NULL) rgb_header_->::config::RGB::Clear();
-  clear_has_rgb_header();
-}
-const ::config::RGB& CalendarConfig::rgb_header() const {
-  // @@protoc_insertion_point(field_get:config.CalendarConfig.rgb_header)
-  return rgb_header_ != NULL ? *rgb_header_ : *default_instance_->rgb_header_;
-}
-::config::RGB* CalendarConfig::mutable_rgb_header() {
-  set_has_rgb_header();
-  if (rgb_header_ == NULL) {
-    rgb_header_ = new ::config::RGB;
-  }
-  // @@protoc_insertion_point(field_mutable:config.CalendarConfig.rgb_header)
-  return rgb_header_;
-}
-::config::RGB* CalendarConfig::release_rgb_header() {
-  // @@protoc_insertion_point(field_release:config.CalendarConfig.rgb_header)
-  clear_has_rgb_header();
-  ::config::RGB* temp = rgb_header_;
-  rgb_header_ = NULL;
-  return temp;
-}
-void CalendarConfig::set_allocated_rgb_header(::config::RGB* rgb_header) {
-  delete rgb_header_;
-  rgb_header_ = rgb_header;
-  if (rgb_header) {
-    set_has_rgb_header();
-  } else {
-    clear_has_rgb_header();
-  }
-  // @@protoc_insertion_point(field_set_allocated:config.CalendarConfig.rgb_header)
-}
+// ===================================================================
 
-// optional .config.RGB rgb_header_sunday = 13;
-bool CalendarConfig::has_rgb_header_sunday() const {
-  return (_has_bits_[0] & 0x00001000u) != 0;
-}
-void CalendarConfig::set_has_rgb_header_sunday() {
-  _has_bits_[0] |= 0x00001000u;
-}
-void CalendarConfig::clear_has_rgb_header_sunday() {
-  _has_bits_[0] &= ~0x00001000u;
-}
-void CalendarConfig::clear_rgb_header_sunday() {
-  if (rgb_header_sunday_ != NULL) rgb_header_sunday_->::config::RGB::Clear();
-  clear_has_rgb_header_sunday();
-}
-const ::config::RGB& CalendarConfig::rgb_header_sunday() const {
-  // @@protoc_insertion_point(field_get:config.CalendarConfig.rgb_header_sunday)
-  return rgb_header_sunday_ != NULL ? *rgb_header_sunday_ : *default_instance_->rgb_header_sunday_;
-}
-::config::RGB* CalendarConfig::mutable_rgb_header_sunday() {
-  set_has_rgb_header_sunday();
-  if (rgb_header_sunday_ == NULL) {
-    rgb_header_sunday_ = new ::config::RGB;
+class SpecialDay::_Internal {
+ public:
+  using HasBits = decltype(std::declval<SpecialDay>()._impl_._has_bits_);
+  static void set_has_month(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
   }
-  // @@protoc_insertion_point(field_mutable:config.CalendarConfig.rgb_header_sunday)
-  return rgb_header_sunday_;
-}
-::config::RGB* CalendarConfig::release_rgb_header_sunday() {
-  // @@protoc_insertion_point(field_release:config.CalendarConfig.rgb_header_sunday)
-  clear_has_rgb_header_sunday();
-  ::config::RGB* temp = rgb_header_sunday_;
-  rgb_header_sunday_ = NULL;
-  return temp;
-}
-void CalendarConfig::set_allocated_rgb_header_sunday(::config::RGB* rgb_header_sunday) {
-  delete rgb_header_sunday_;
-  rgb_header_sunday_ = rgb_header_sunday;
-  if (rgb_header_sunday) {
-    set_has_rgb_header_sunday();
-  } else {
-    clear_has_rgb_header_sunday();
+  static void set_has_day(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
   }
-  // @@protoc_insertion_point(field_set_allocated:config.CalendarConfig.rgb_header_sunday)
-}
-
-// optional .config.RGB rgb_month_line = 14;
-bool CalendarConfig::has_rgb_month_line() const {
-  return (_has_bits_[0] & 0x00002000u) != 0;
-}
-void CalendarConfig::set_has_rgb_month_line() {
-  _has_bits_[0] |= 0x00002000u;
-}
-void CalendarConfig::clear_has_rgb_month_line() {
-  _has_bits_[0] &= ~0x00002000u;
-}
-void CalendarConfig::clear_rgb_month_line() {
-  if (rgb_month_line_ != NULL) rgb_month_line_->::config::RGB::Clear();
-  clear_has_rgb_month_line();
-}
-const ::config::RGB& CalendarConfig::rgb_month_line() const {
-  // @@protoc_insertion_point(field_get:config.CalendarConfig.rgb_month_line)
-  return rgb_month_line_ != NULL ? *rgb_month_line_ : *default_instance_->rgb_month_line_;
-}
-::config::RGB* CalendarConfig::mutable_rgb_month_line() {
-  set_has_rgb_month_line();
-  if (rgb_month_line_ == NULL) {
-    rgb_month_line_ = new ::config::RGB;
+  static void set_has_svg(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
   }
-  // @@protoc_insertion_point(field_mutable:config.CalendarConfig.rgb_month_line)
-  return rgb_month_line_;
-}
-::config::RGB* CalendarConfig::release_rgb_month_line() {
-  // @@protoc_insertion_point(field_release:config.CalendarConfig.rgb_month_line)
-  clear_has_rgb_month_line();
-  ::config::RGB* temp = rgb_month_line_;
-  rgb_month_line_ = NULL;
-  return temp;
-}
-void CalendarConfig::set_allocated_rgb_month_line(::config::RGB* rgb_month_line) {
-  delete rgb_month_line_;
-  rgb_month_line_ = rgb_month_line;
-  if (rgb_month_line) {
-    set_has_rgb_month_line();
-  } else {
-    clear_has_rgb_month_line();
+  static void set_has_first_year(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
   }
-  // @@protoc_insertion_point(field_set_allocated:config.CalendarConfig.rgb_month_line)
-}
-
-// optional .config.RGB rgb_holiday = 15;
-bool CalendarConfig::has_rgb_holiday() const {
-  return (_has_bits_[0] & 0x00004000u) != 0;
-}
-void CalendarConfig::set_has_rgb_holiday() {
-  _has_bits_[0] |= 0x00004000u;
-}
-void CalendarConfig::clear_has_rgb_holiday() {
-  _has_bits_[0] &= ~0x00004000u;
-}
-void CalendarConfig::clear_rgb_holiday() {
-  if (rgb_holiday_ != NULL) rgb_holiday_->::config::RGB::Clear();
-  clear_has_rgb_holiday();
-}
-const ::config::RGB& CalendarConfig::rgb_holiday() const {
-  // @@protoc_insertion_point(field_get:config.CalendarConfig.rgb_holiday)
-  return rgb_holiday_ != NULL ? *rgb_holiday_ : *default_instance_->rgb_holiday_;
-}
-::config::RGB* CalendarConfig::mutable_rgb_holiday() {
-  set_has_rgb_holiday();
-  if (rgb_holiday_ == NULL) {
-    rgb_holiday_ = new ::config::RGB;
+  static void set_has_year(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
   }
-  // @@protoc_insertion_point(field_mutable:config.CalendarConfig.rgb_holiday)
-  return rgb_holiday_;
-}
-::config::RGB* CalendarConfig::release_rgb_holiday() {
-  // @@protoc_insertion_point(field_release:config.CalendarConfig.rgb_holiday)
-  clear_has_rgb_holiday();
-  ::config::RGB* temp = rgb_holiday_;
-  rgb_holiday_ = NULL;
-  return temp;
-}
-void CalendarConfig::set_allocated_rgb_holiday(::config::RGB* rgb_holiday) {
-  delete rgb_holiday_;
-  rgb_holiday_ = rgb_holiday;
-  if (rgb_holiday) {
-    set_has_rgb_holiday();
-  } else {
-    clear_has_rgb_holiday();
+  static const ::config::RGB& rgb(const SpecialDay* msg);
+  static void set_has_rgb(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
   }
-  // @@protoc_insertion_point(field_set_allocated:config.CalendarConfig.rgb_holiday)
-}
-
-// optional string bottom_left_label = 16;
-bool CalendarConfig::has_bottom_left_label() const {
-  return (_has_bits_[0] & 0x00008000u) != 0;
-}
-void CalendarConfig::set_has_bottom_left_label() {
-  _has_bits_[0] |= 0x00008000u;
-}
-void CalendarConfig::clear_has_bottom_left_label() {
-  _has_bits_[0] &= ~0x00008000u;
-}
-void CalendarConfig::clear_bottom_left_label() {
-  bottom_left_label_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  clear_has_bottom_left_label();
-}
- const ::std::string& CalendarConfig::bottom_left_label() const {
-  // @@protoc_insertion_point(field_get:config.CalendarConfig.bottom_left_label)
-  return bottom_left_label_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
- void CalendarConfig::set_bottom_left_label(const ::std::string& value) {
-  set_has_bottom_left_label();
-  bottom_left_label_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:config.CalendarConfig.bottom_left_label)
-}
- void CalendarConfig::set_bottom_left_label(const char* value) {
-  set_has_bottom_left_label();
-  bottom_left_label_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:config.CalendarConfig.bottom_left_label)
-}
- void CalendarConfig::set_bottom_left_label(const char* value, size_t size) {
-  set_has_bottom_left_label();
-  bottom_left_label_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:config.CalendarConfig.bottom_left_label)
-}
- ::std::string* CalendarConfig::mutable_bottom_left_label() {
-  set_has_bottom_left_label();
-  // @@protoc_insertion_point(field_mutable:config.CalendarConfig.bottom_left_label)
-  return bottom_left_label_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
- ::std::string* CalendarConfig::release_bottom_left_label() {
-  // @@protoc_insertion_point(field_release:config.CalendarConfig.bottom_left_label)
-  clear_has_bottom_left_label();
-  return bottom_left_label_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
- void CalendarConfig::set_allocated_bottom_left_label(::std::string* bottom_left_label) {
-  if (bottom_left_label != NULL) {
-    set_has_bottom_left_label();
-  } else {
-    clear_has_bottom_left_label();
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x0000000c) ^ 0x0000000c) != 0;
   }
-  bottom_left_label_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), bottom_left_label);
-  // @@protoc_insertion_point(field_set_allocated:config.CalendarConfig.bottom_left_label)
-}
+};
 
-// optional string bottom_right_label = 17;
-bool CalendarConfig::has_bottom_right_label() const {
-  return (_has_bits_[0] & 0x00010000u) != 0;
-}
-void CalendarConfig::set_has_bottom_right_label() {
-  _has_bits_[0] |= 0x00010000u;
-}
-void CalendarConfig::clear_has_bottom_right_label() {
-  _has_bits_[0] &= ~0x00010000u;
-}
-void CalendarConfig::clear_bottom_right_label() {
-  bottom_right_label_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  clear_has_bottom_right_label();
-}
- const ::std::string& CalendarConfig::bottom_right_label() const {
-  // @@protoc_insertion_point(field_get:config.CalendarConfig.bottom_right_label)
-  return bottom_right_label_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
- void CalendarConfig::set_bottom_right_label(const ::std::string& value) {
-  set_has_bottom_right_label();
-  bottom_right_label_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:config.CalendarConfig.bottom_right_label)
+const ::config::RGB&
+SpecialDay::_Internal::rgb(const SpecialDay* msg) {
+  return *msg->_impl_.rgb_;
 }
- void CalendarConfig::set_bottom_right_label(const char* value) {
-  set_has_bottom_right_label();
-  bottom_right_label_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:config.CalendarConfig.bottom_right_label)
-}
- void CalendarConfig::set_bottom_right_label(const char* value, size_t size) {
-  set_has_bottom_right_label();
-  bottom_right_label_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:config.CalendarConfig.bottom_right_label)
-}
- ::std::string* CalendarConfig::mutable_bottom_right_label() {
-  set_has_bottom_right_label();
-  // @@protoc_insertion_point(field_mutable:config.CalendarConfig.bottom_right_label)
-  return bottom_right_label_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
- ::std::string* CalendarConfig::release_bottom_right_label() {
-  // @@protoc_insertion_point(field_release:config.CalendarConfig.bottom_right_label)
-  clear_has_bottom_right_label();
-  return bottom_right_label_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
- void CalendarConfig::set_allocated_bottom_right_label(::std::string* bottom_right_label) {
-  if (bottom_right_label != NULL) {
-    set_has_bottom_right_label();
-  } else {
-    clear_has_bottom_right_label();
-  }
-  bottom_right_label_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), bottom_right_label);
-  // @@protoc_insertion_point(field_set_allocated:config.CalendarConfig.bottom_right_label)
-}
-
-// optional string header_font_family = 18;
-bool CalendarConfig::has_header_font_family() const {
-  return (_has_bits_[0] & 0x00020000u) != 0;
+SpecialDay::SpecialDay(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:config.SpecialDay)
 }
-void CalendarConfig::set_has_header_font_family() {
-  _has_bits_[0] |= 0x00020000u;
-}
-void CalendarConfig::clear_has_header_font_family() {
-  _has_bits_[0] &= ~0x00020000u;
-}
-void CalendarConfig::clear_header_font_family() {
-  header_font_family_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  clear_has_header_font_family();
-}
- const ::std::string& CalendarConfig::header_font_family() const {
-  // @@protoc_insertion_point(field_get:config.CalendarConfig.header_font_family)
-  return header_font_family_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
- void CalendarConfig::set_header_font_family(const ::std::string& value) {
-  set_has_header_font_family();
-  header_font_family_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:config.CalendarConfig.header_font_family)
-}
- void CalendarConfig::set_header_font_family(const char* value) {
-  set_has_header_font_family();
-  header_font_family_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:config.CalendarConfig.header_font_family)
-}
- void CalendarConfig::set_header_font_family(const char* value, size_t size) {
-  set_has_header_font_family();
-  header_font_family_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:config.CalendarConfig.header_font_family)
-}
- ::std::string* CalendarConfig::mutable_header_font_family() {
-  set_has_header_font_family();
-  // @@protoc_insertion_point(field_mutable:config.CalendarConfig.header_font_family)
-  return header_font_family_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
- ::std::string* CalendarConfig::release_header_font_family() {
-  // @@protoc_insertion_point(field_release:config.CalendarConfig.header_font_family)
-  clear_has_header_font_family();
-  return header_font_family_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
- void CalendarConfig::set_allocated_header_font_family(::std::string* header_font_family) {
-  if (header_font_family != NULL) {
-    set_has_header_font_family();
-  } else {
-    clear_has_header_font_family();
-  }
-  header_font_family_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), header_font_family);
-  // @@protoc_insertion_point(field_set_allocated:config.CalendarConfig.header_font_family)
-}
-
-// optional string number_font_family = 19;
-bool CalendarConfig::has_number_font_family() const {
-  return (_has_bits_[0] & 0x00040000u) != 0;
-}
-void CalendarConfig::set_has_number_font_family() {
-  _has_bits_[0] |= 0x00040000u;
-}
-void CalendarConfig::clear_has_number_font_family() {
-  _has_bits_[0] &= ~0x00040000u;
-}
-void CalendarConfig::clear_number_font_family() {
-  number_font_family_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  clear_has_number_font_family();
-}
- const ::std::string& CalendarConfig::number_font_family() const {
-  // @@protoc_insertion_point(field_get:config.CalendarConfig.number_font_family)
-  return number_font_family_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
- void CalendarConfig::set_number_font_family(const ::std::string& value) {
-  set_has_number_font_family();
-  number_font_family_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:config.CalendarConfig.number_font_family)
-}
- void CalendarConfig::set_number_font_family(const char* value) {
-  set_has_number_font_family();
-  number_font_family_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:config.CalendarConfig.number_font_family)
-}
- void CalendarConfig::set_number_font_family(const char* value, size_t size) {
-  set_has_number_font_family();
-  number_font_family_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:config.CalendarConfig.number_font_family)
-}
- ::std::string* CalendarConfig::mutable_number_font_family() {
-  set_has_number_font_family();
-  // @@protoc_insertion_point(field_mutable:config.CalendarConfig.number_font_family)
-  return number_font_family_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
- ::std::string* CalendarConfig::release_number_font_family() {
-  // @@protoc_insertion_point(field_release:config.CalendarConfig.number_font_family)
-  clear_has_number_font_family();
-  return number_font_family_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
- void CalendarConfig::set_allocated_number_font_family(::std::string* number_font_family) {
-  if (number_font_family != NULL) {
-    set_has_number_font_family();
-  } else {
-    clear_has_number_font_family();
-  }
-  number_font_family_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), number_font_family);
-  // @@protoc_insertion_point(field_set_allocated:config.CalendarConfig.number_font_family)
-}
-
-// optional string quote_font_family = 20;
-bool CalendarConfig::has_quote_font_family() const {
-  return (_has_bits_[0] & 0x00080000u) != 0;
-}
-void CalendarConfig::set_has_quote_font_family() {
-  _has_bits_[0] |= 0x00080000u;
-}
-void CalendarConfig::clear_has_quote_font_family() {
-  _has_bits_[0] &= ~0x00080000u;
-}
-void CalendarConfig::clear_quote_font_family() {
-  quote_font_family_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  clear_has_quote_font_family();
-}
- const ::std::string& CalendarConfig::quote_font_family() const {
-  // @@protoc_insertion_point(field_get:config.CalendarConfig.quote_font_family)
-  return quote_font_family_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
- void CalendarConfig::set_quote_font_family(const ::std::string& value) {
-  set_has_quote_font_family();
-  quote_font_family_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:config.CalendarConfig.quote_font_family)
-}
- void CalendarConfig::set_quote_font_family(const char* value) {
-  set_has_quote_font_family();
-  quote_font_family_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:config.CalendarConfig.quote_font_family)
-}
- void CalendarConfig::set_quote_font_family(const char* value, size_t size) {
-  set_has_quote_font_family();
-  quote_font_family_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:config.CalendarConfig.quote_font_family)
-}
- ::std::string* CalendarConfig::mutable_quote_font_family() {
-  set_has_quote_font_family();
-  // @@protoc_insertion_point(field_mutable:config.CalendarConfig.quote_font_family)
-  return quote_font_family_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
- ::std::string* CalendarConfig::release_quote_font_family() {
-  // @@protoc_insertion_point(field_release:config.CalendarConfig.quote_font_family)
-  clear_has_quote_font_family();
-  return quote_font_family_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
- void CalendarConfig::set_allocated_quote_font_family(::std::string* quote_font_family) {
-  if (quote_font_family != NULL) {
-    set_has_quote_font_family();
-  } else {
-    clear_has_quote_font_family();
-  }
-  quote_font_family_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), quote_font_family);
-  // @@protoc_insertion_point(field_set_allocated:config.CalendarConfig.quote_font_family)
-}
-
-// optional bool dotted_line = 21 [default = false];
-bool CalendarConfig::has_dotted_line() const {
-  return (_has_bits_[0] & 0x00100000u) != 0;
-}
-void CalendarConfig::set_has_dotted_line() {
-  _has_bits_[0] |= 0x00100000u;
-}
-void CalendarConfig::clear_has_dotted_line() {
-  _has_bits_[0] &= ~0x00100000u;
-}
-void CalendarConfig::clear_dotted_line() {
-  dotted_line_ = false;
-  clear_has_dotted_line();
-}
- bool CalendarConfig::dotted_line() const {
-  // @@protoc_insertion_point(field_get:config.CalendarConfig.dotted_line)
-  return dotted_line_;
-}
- void CalendarConfig::set_dotted_line(bool value) {
-  set_has_dotted_line();
-  dotted_line_ = value;
-  // @@protoc_insertion_point(field_set:config.CalendarConfig.dotted_line)
-}
-
-// optional double vertical_dotted_line_x = 22;
-bool CalendarConfig::has_vertical_dotted_line_x() const {
-  return (_has_bits_[0] & 0x00200000u) != 0;
-}
-void CalendarConfig::set_has_vertical_dotted_line_x() {
-  _has_bits_[0] |= 0x00200000u;
-}
-void CalendarConfig::clear_has_vertical_dotted_line_x() {
-  _has_bits_[0] &= ~0x00200000u;
-}
-void CalendarConfig::clear_vertical_dotted_line_x() {
-  vertical_dotted_line_x_ = 0;
-  clear_has_vertical_dotted_line_x();
-}
- double CalendarConfig::vertical_dotted_line_x() const {
-  // @@protoc_insertion_point(field_get:config.CalendarConfig.vertical_dotted_line_x)
-  return vertical_dotted_line_x_;
-}
- void CalendarConfig::set_vertical_dotted_line_x(double value) {
-  set_has_vertical_dotted_line_x();
-  vertical_dotted_line_x_ = value;
-  // @@protoc_insertion_point(field_set:config.CalendarConfig.vertical_dotted_line_x)
-}
-
-// optional .config.OutputType output_type = 23 [default = SVG];
-bool CalendarConfig::has_output_type() const {
-  return (_has_bits_[0] & 0x00400000u) != 0;
-}
-void CalendarConfig::set_has_output_type() {
-  _has_bits_[0] |= 0x00400000u;
-}
-void CalendarConfig::clear_has_output_type() {
-  _has_bits_[0] &= ~0x00400000u;
-}
-void CalendarConfig::clear_output_type() {
-  output_type_ = 0;
-  clear_has_output_type();
-}
- ::config::OutputType CalendarConfig::output_type() const {
-  // @@protoc_insertion_point(field_get:config.CalendarConfig.output_type)
-  return static_cast< ::config::OutputType >(output_type_);
-}
- void CalendarConfig::set_output_type(::config::OutputType value) {
-  assert(::config::OutputType_IsValid(value));
-  set_has_output_type();
-  output_type_ = value;
-  // @@protoc_insertion_point(field_set:config.CalendarConfig.output_type)
-}
-
-#endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
-
-// ===================================================================
-
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int SpecialDay::kMonthFieldNumber;
-const int SpecialDay::kDayFieldNumber;
-const int SpecialDay::kSvgFieldNumber;
-const int SpecialDay::kFirstYearFieldNumber;
-const int SpecialDay::kYearFieldNumber;
-const int SpecialDay::kRgbFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
-
-SpecialDay::SpecialDay()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:config.SpecialDay)
-}
-
-void SpecialDay::InitAsDefaultInstance() {
-  rgb_ = const_cast< ::config::RGB*>(&::config::RGB::default_instance());
-}
-
 SpecialDay::SpecialDay(const SpecialDay& from)
-  : ::google::protobuf::Message(),
-    _internal_metadata_(NULL) {
-  SharedCtor();
-  MergeFrom(from);
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SpecialDay* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.svg_){}
+    , decltype(_impl_.rgb_){nullptr}
+    , decltype(_impl_.month_){}
+    , decltype(_impl_.day_){}
+    , decltype(_impl_.first_year_){}
+    , decltype(_impl_.year_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.svg_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.svg_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_svg()) {
+    _this->_impl_.svg_.Set(from._internal_svg(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_rgb()) {
+    _this->_impl_.rgb_ = new ::config::RGB(*from._impl_.rgb_);
+  }
+  ::memcpy(&_impl_.month_, &from._impl_.month_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.year_) -
+    reinterpret_cast<char*>(&_impl_.month_)) + sizeof(_impl_.year_));
   // @@protoc_insertion_point(copy_constructor:config.SpecialDay)
 }
 
-void SpecialDay::SharedCtor() {
-  ::google::protobuf::internal::GetEmptyString();
-  _cached_size_ = 0;
-  month_ = 0;
-  day_ = 0;
-  svg_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  first_year_ = 0;
-  year_ = 0;
-  rgb_ = NULL;
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+inline void SpecialDay::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.svg_){}
+    , decltype(_impl_.rgb_){nullptr}
+    , decltype(_impl_.month_){0}
+    , decltype(_impl_.day_){0}
+    , decltype(_impl_.first_year_){0}
+    , decltype(_impl_.year_){0}
+  };
+  _impl_.svg_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.svg_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 SpecialDay::~SpecialDay() {
   // @@protoc_insertion_point(destructor:config.SpecialDay)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void SpecialDay::SharedDtor() {
-  svg_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (this != default_instance_) {
-    delete rgb_;
-  }
+inline void SpecialDay::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.svg_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.rgb_;
 }
 
 void SpecialDay::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* SpecialDay::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return SpecialDay_descriptor_;
+  _impl_._cached_size_.Set(size);
 }
 
-const SpecialDay& SpecialDay::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_config_2eproto();
-  return *default_instance_;
-}
-
-SpecialDay* SpecialDay::default_instance_ = NULL;
+void SpecialDay::Clear() {
+// @@protoc_insertion_point(message_clear_start:config.SpecialDay)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
-SpecialDay* SpecialDay::New(::google::protobuf::Arena* arena) const {
-  SpecialDay* n = new SpecialDay;
-  if (arena != NULL) {
-    arena->Own(n);
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.svg_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      GOOGLE_DCHECK(_impl_.rgb_ != nullptr);
+      _impl_.rgb_->Clear();
+    }
+  }
+  if (cached_has_bits & 0x0000003cu) {
+    ::memset(&_impl_.month_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.year_) -
+        reinterpret_cast<char*>(&_impl_.month_)) + sizeof(_impl_.year_));
   }
-  return n;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void SpecialDay::Clear() {
-// @@protoc_insertion_point(message_clear_start:config.SpecialDay)
-#if defined(__clang__)
-#define ZR_HELPER_(f) \
-  _Pragma("clang diagnostic push") \
-  _Pragma("clang diagnostic ignored \"-Winvalid-offsetof\"") \
-  __builtin_offsetof(SpecialDay, f) \
-  _Pragma("clang diagnostic pop")
-#else
-#define ZR_HELPER_(f) reinterpret_cast<char*>(\
-  &reinterpret_cast<SpecialDay*>(16)->f)
-#endif
-
-#define ZR_(first, last) do {\
-  ::memset(&first, 0,\
-           ZR_HELPER_(last) - ZR_HELPER_(first) + sizeof(last));\
-} while (0)
-
-  if (_has_bits_[0 / 32] & 63u) {
-    ZR_(month_, day_);
-    ZR_(first_year_, year_);
-    if (has_svg()) {
-      svg_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-    }
-    if (has_rgb()) {
-      if (rgb_ != NULL) rgb_->::config::RGB::Clear();
-    }
-  }
-
-#undef ZR_HELPER_
-#undef ZR_
-
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  if (_internal_metadata_.have_unknown_fields()) {
-    mutable_unknown_fields()->Clear();
-  }
-}
-
-bool SpecialDay::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:config.SpecialDay)
-  for (;;) {
-    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoff(127);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+const char* SpecialDay::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // required int32 month = 1;
-      case 1: {
-        if (tag == 8) {
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 input, &month_)));
-          set_has_month();
-        } else {
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_month(&has_bits);
+          _impl_.month_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectTag(16)) goto parse_day;
-        break;
-      }
-
+        continue;
       // required int32 day = 2;
-      case 2: {
-        if (tag == 16) {
-         parse_day:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 input, &day_)));
-          set_has_day();
-        } else {
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_day(&has_bits);
+          _impl_.day_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectTag(26)) goto parse_svg;
-        break;
-      }
-
+        continue;
       // optional string svg = 3;
-      case 3: {
-        if (tag == 26) {
-         parse_svg:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_svg()));
-          ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
-            this->svg().data(), this->svg().length(),
-            ::google::protobuf::internal::WireFormat::PARSE,
-            "config.SpecialDay.svg");
-        } else {
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_svg();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "config.SpecialDay.svg");
+          #endif  // !NDEBUG
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectTag(32)) goto parse_first_year;
-        break;
-      }
-
+        continue;
       // optional int32 first_year = 4;
-      case 4: {
-        if (tag == 32) {
-         parse_first_year:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 input, &first_year_)));
-          set_has_first_year();
-        } else {
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _Internal::set_has_first_year(&has_bits);
+          _impl_.first_year_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectTag(40)) goto parse_year;
-        break;
-      }
-
+        continue;
       // optional int32 year = 5;
-      case 5: {
-        if (tag == 40) {
-         parse_year:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 input, &year_)));
-          set_has_year();
-        } else {
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _Internal::set_has_year(&has_bits);
+          _impl_.year_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectTag(50)) goto parse_rgb;
-        break;
-      }
-
+        continue;
       // optional .config.RGB rgb = 6;
-      case 6: {
-        if (tag == 50) {
-         parse_rgb:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_rgb()));
-        } else {
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          ptr = ctx->ParseMessage(_internal_mutable_rgb(), ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectAtEnd()) goto success;
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0 ||
-            ::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
-    }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:config.SpecialDay)
-  return true;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:config.SpecialDay)
-  return false;
-#undef DO_
-}
-
-void SpecialDay::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:config.SpecialDay)
-  // required int32 month = 1;
-  if (has_month()) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt32(1, this->month(), output);
-  }
-
-  // required int32 day = 2;
-  if (has_day()) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt32(2, this->day(), output);
-  }
-
-  // optional string svg = 3;
-  if (has_svg()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
-      this->svg().data(), this->svg().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE,
-      "config.SpecialDay.svg");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      3, this->svg(), output);
-  }
-
-  // optional int32 first_year = 4;
-  if (has_first_year()) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt32(4, this->first_year(), output);
-  }
-
-  // optional int32 year = 5;
-  if (has_year()) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt32(5, this->year(), output);
-  }
-
-  // optional .config.RGB rgb = 6;
-  if (has_rgb()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      6, *this->rgb_, output);
-  }
-
-  if (_internal_metadata_.have_unknown_fields()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
-  }
-  // @@protoc_insertion_point(serialize_end:config.SpecialDay)
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-::google::protobuf::uint8* SpecialDay::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
+uint8_t* SpecialDay::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:config.SpecialDay)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
   // required int32 month = 1;
-  if (has_month()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(1, this->month(), target);
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_month(), target);
   }
 
   // required int32 day = 2;
-  if (has_day()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(2, this->day(), target);
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_day(), target);
   }
 
   // optional string svg = 3;
-  if (has_svg()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
-      this->svg().data(), this->svg().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE,
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_svg().data(), static_cast<int>(this->_internal_svg().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
       "config.SpecialDay.svg");
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        3, this->svg(), target);
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_svg(), target);
   }
 
   // optional int32 first_year = 4;
-  if (has_first_year()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(4, this->first_year(), target);
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(4, this->_internal_first_year(), target);
   }
 
   // optional int32 year = 5;
-  if (has_year()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(5, this->year(), target);
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(5, this->_internal_year(), target);
   }
 
   // optional .config.RGB rgb = 6;
-  if (has_rgb()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      InternalWriteMessageNoVirtualToArray(
-        6, *this->rgb_, false, target);
+  if (cached_has_bits & 0x00000002u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(6, _Internal::rgb(this),
+        _Internal::rgb(this).GetCachedSize(), target, stream);
   }
 
-  if (_internal_metadata_.have_unknown_fields()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:config.SpecialDay)
   return target;
 }
 
-int SpecialDay::RequiredFieldsByteSizeFallback() const {
+size_t SpecialDay::RequiredFieldsByteSizeFallback() const {
 // @@protoc_insertion_point(required_fields_byte_size_fallback_start:config.SpecialDay)
-  int total_size = 0;
+  size_t total_size = 0;
 
-  if (has_month()) {
+  if (_internal_has_month()) {
     // required int32 month = 1;
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::Int32Size(
-        this->month());
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_month());
   }
 
-  if (has_day()) {
+  if (_internal_has_day()) {
     // required int32 day = 2;
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::Int32Size(
-        this->day());
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_day());
   }
 
   return total_size;
 }
-int SpecialDay::ByteSize() const {
+size_t SpecialDay::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:config.SpecialDay)
-  int total_size = 0;
+  size_t total_size = 0;
 
-  if (((_has_bits_[0] & 0x00000003) ^ 0x00000003) == 0) {  // All required fields are present.
+  if (((_impl_._has_bits_[0] & 0x0000000c) ^ 0x0000000c) == 0) {  // All required fields are present.
     // required int32 month = 1;
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::Int32Size(
-        this->month());
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_month());
 
     // required int32 day = 2;
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::Int32Size(
-        this->day());
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_day());
 
   } else {
     total_size += RequiredFieldsByteSizeFallback();
   }
-  if (_has_bits_[2 / 32] & 60u) {
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
     // optional string svg = 3;
-    if (has_svg()) {
+    if (cached_has_bits & 0x00000001u) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::StringSize(
-          this->svg());
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_svg());
     }
 
-    // optional int32 first_year = 4;
-    if (has_first_year()) {
+    // optional .config.RGB rgb = 6;
+    if (cached_has_bits & 0x00000002u) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::Int32Size(
-          this->first_year());
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.rgb_);
     }
 
-    // optional int32 year = 5;
-    if (has_year()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::Int32Size(
-          this->year());
+  }
+  if (cached_has_bits & 0x00000030u) {
+    // optional int32 first_year = 4;
+    if (cached_has_bits & 0x00000010u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_first_year());
     }
 
-    // optional .config.RGB rgb = 6;
-    if (has_rgb()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          *this->rgb_);
+    // optional int32 year = 5;
+    if (cached_has_bits & 0x00000020u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_year());
     }
 
   }
-  if (_internal_metadata_.have_unknown_fields()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
-  }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
-}
-
-void SpecialDay::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:config.SpecialDay)
-  if (GOOGLE_PREDICT_FALSE(&from == this)) {
-    ::google::protobuf::internal::MergeFromFail(__FILE__, __LINE__);
-  }
-  const SpecialDay* source = 
-      ::google::protobuf::internal::DynamicCastToGenerated<const SpecialDay>(
-          &from);
-  if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:config.SpecialDay)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:config.SpecialDay)
-    MergeFrom(*source);
-  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void SpecialDay::MergeFrom(const SpecialDay& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:config.SpecialDay)
-  if (GOOGLE_PREDICT_FALSE(&from == this)) {
-    ::google::protobuf::internal::MergeFromFail(__FILE__, __LINE__);
-  }
-  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_month()) {
-      set_month(from.month());
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SpecialDay::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SpecialDay::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SpecialDay::GetClassData() const { return &_class_data_; }
+
+
+void SpecialDay::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SpecialDay*>(&to_msg);
+  auto& from = static_cast<const SpecialDay&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:config.SpecialDay)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000003fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_svg(from._internal_svg());
     }
-    if (from.has_day()) {
-      set_day(from.day());
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_mutable_rgb()->::config::RGB::MergeFrom(
+          from._internal_rgb());
     }
-    if (from.has_svg()) {
-      set_has_svg();
-      svg_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.svg_);
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.month_ = from._impl_.month_;
     }
-    if (from.has_first_year()) {
-      set_first_year(from.first_year());
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.day_ = from._impl_.day_;
     }
-    if (from.has_year()) {
-      set_year(from.year());
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.first_year_ = from._impl_.first_year_;
     }
-    if (from.has_rgb()) {
-      mutable_rgb()->::config::RGB::MergeFrom(from.rgb());
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.year_ = from._impl_.year_;
     }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
   }
-  if (from._internal_metadata_.have_unknown_fields()) {
-    mutable_unknown_fields()->MergeFrom(from.unknown_fields());
-  }
-}
-
-void SpecialDay::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:config.SpecialDay)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void SpecialDay::CopyFrom(const SpecialDay& from) {
@@ -2721,565 +2094,290 @@ void SpecialDay::CopyFrom(const SpecialDay& from) {
 }
 
 bool SpecialDay::IsInitialized() const {
-  if ((_has_bits_[0] & 0x00000003) != 0x00000003) return false;
-
-  if (has_rgb()) {
-    if (!this->rgb_->IsInitialized()) return false;
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (_internal_has_rgb()) {
+    if (!_impl_.rgb_->IsInitialized()) return false;
   }
   return true;
 }
 
-void SpecialDay::Swap(SpecialDay* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void SpecialDay::InternalSwap(SpecialDay* other) {
-  std::swap(month_, other->month_);
-  std::swap(day_, other->day_);
-  svg_.Swap(&other->svg_);
-  std::swap(first_year_, other->first_year_);
-  std::swap(year_, other->year_);
-  std::swap(rgb_, other->rgb_);
-  std::swap(_has_bits_[0], other->_has_bits_[0]);
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  std::swap(_cached_size_, other->_cached_size_);
-}
-
-::google::protobuf::Metadata SpecialDay::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = SpecialDay_descriptor_;
-  metadata.reflection = SpecialDay_reflection_;
-  return metadata;
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.svg_, lhs_arena,
+      &other->_impl_.svg_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(SpecialDay, _impl_.year_)
+      + sizeof(SpecialDay::_impl_.year_)
+      - PROTOBUF_FIELD_OFFSET(SpecialDay, _impl_.rgb_)>(
+          reinterpret_cast<char*>(&_impl_.rgb_),
+          reinterpret_cast<char*>(&other->_impl_.rgb_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata SpecialDay::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_config_2eproto_getter, &descriptor_table_config_2eproto_once,
+      file_level_metadata_config_2eproto[1]);
 }
 
-#if PROTOBUF_INLINE_NOT_IN_HEADERS
-// SpecialDay
-
-// required int32 month = 1;
-bool SpecialDay::has_month() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
-}
-void SpecialDay::set_has_month() {
-  _has_bits_[0] |= 0x00000001u;
-}
-void SpecialDay::clear_has_month() {
-  _has_bits_[0] &= ~0x00000001u;
-}
-void SpecialDay::clear_month() {
-  month_ = 0;
-  clear_has_month();
-}
- ::google::protobuf::int32 SpecialDay::month() const {
-  // @@protoc_insertion_point(field_get:config.SpecialDay.month)
-  return month_;
-}
- void SpecialDay::set_month(::google::protobuf::int32 value) {
-  set_has_month();
-  month_ = value;
-  // @@protoc_insertion_point(field_set:config.SpecialDay.month)
-}
-
-// required int32 day = 2;
-bool SpecialDay::has_day() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
-}
-void SpecialDay::set_has_day() {
-  _has_bits_[0] |= 0x00000002u;
-}
-void SpecialDay::clear_has_day() {
-  _has_bits_[0] &= ~0x00000002u;
-}
-void SpecialDay::clear_day() {
-  day_ = 0;
-  clear_has_day();
-}
- ::google::protobuf::int32 SpecialDay::day() const {
-  // @@protoc_insertion_point(field_get:config.SpecialDay.day)
-  return day_;
-}
- void SpecialDay::set_day(::google::protobuf::int32 value) {
-  set_has_day();
-  day_ = value;
-  // @@protoc_insertion_point(field_set:config.SpecialDay.day)
-}
+// ===================================================================
 
-// optional string svg = 3;
-bool SpecialDay::has_svg() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
-}
-void SpecialDay::set_has_svg() {
-  _has_bits_[0] |= 0x00000004u;
-}
-void SpecialDay::clear_has_svg() {
-  _has_bits_[0] &= ~0x00000004u;
-}
-void SpecialDay::clear_svg() {
-  svg_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  clear_has_svg();
-}
- const ::std::string& SpecialDay::svg() const {
-  // @@protoc_insertion_point(field_get:config.SpecialDay.svg)
-  return svg_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
- void SpecialDay::set_svg(const ::std::string& value) {
-  set_has_svg();
-  svg_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:config.SpecialDay.svg)
-}
- void SpecialDay::set_svg(const char* value) {
-  set_has_svg();
-  svg_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:config.SpecialDay.svg)
-}
- void SpecialDay::set_svg(const char* value, size_t size) {
-  set_has_svg();
-  svg_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:config.SpecialDay.svg)
-}
- ::std::string* SpecialDay::mutable_svg() {
-  set_has_svg();
-  // @@protoc_insertion_point(field_mutable:config.SpecialDay.svg)
-  return svg_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
- ::std::string* SpecialDay::release_svg() {
-  // @@protoc_insertion_point(field_release:config.SpecialDay.svg)
-  clear_has_svg();
-  return svg_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
- void SpecialDay::set_allocated_svg(::std::string* svg) {
-  if (svg != NULL) {
-    set_has_svg();
-  } else {
-    clear_has_svg();
+class RGB::_Internal {
+ public:
+  using HasBits = decltype(std::declval<RGB>()._impl_._has_bits_);
+  static void set_has_red(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
   }
-  svg_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), svg);
-  // @@protoc_insertion_point(field_set_allocated:config.SpecialDay.svg)
-}
-
-// optional int32 first_year = 4;
-bool SpecialDay::has_first_year() const {
-  return (_has_bits_[0] & 0x00000008u) != 0;
-}
-void SpecialDay::set_has_first_year() {
-  _has_bits_[0] |= 0x00000008u;
-}
-void SpecialDay::clear_has_first_year() {
-  _has_bits_[0] &= ~0x00000008u;
-}
-void SpecialDay::clear_first_year() {
-  first_year_ = 0;
-  clear_has_first_year();
-}
- ::google::protobuf::int32 SpecialDay::first_year() const {
-  // @@protoc_insertion_point(field_get:config.SpecialDay.first_year)
-  return first_year_;
-}
- void SpecialDay::set_first_year(::google::protobuf::int32 value) {
-  set_has_first_year();
-  first_year_ = value;
-  // @@protoc_insertion_point(field_set:config.SpecialDay.first_year)
-}
-
-// optional int32 year = 5;
-bool SpecialDay::has_year() const {
-  return (_has_bits_[0] & 0x00000010u) != 0;
-}
-void SpecialDay::set_has_year() {
-  _has_bits_[0] |= 0x00000010u;
-}
-void SpecialDay::clear_has_year() {
-  _has_bits_[0] &= ~0x00000010u;
-}
-void SpecialDay::clear_year() {
-  year_ = 0;
-  clear_has_year();
-}
- ::google::protobuf::int32 SpecialDay::year() const {
-  // @@protoc_insertion_point(field_get:config.SpecialDay.year)
-  return year_;
-}
- void SpecialDay::set_year(::google::protobuf::int32 value) {
-  set_has_year();
-  year_ = value;
-  // @@protoc_insertion_point(field_set:config.SpecialDay.year)
-}
-
-// optional .config.RGB rgb = 6;
-bool SpecialDay::has_rgb() const {
-  return (_has_bits_[0] & 0x00000020u) != 0;
-}
-void SpecialDay::set_has_rgb() {
-  _has_bits_[0] |= 0x00000020u;
-}
-void SpecialDay::clear_has_rgb() {
-  _has_bits_[0] &= ~0x00000020u;
-}
-void SpecialDay::clear_rgb() {
-  if (rgb_ != NULL) rgb_->::config::RGB::Clear();
-  clear_has_rgb();
-}
-const ::config::RGB& SpecialDay::rgb() const {
-  // @@protoc_insertion_point(field_get:config.SpecialDay.rgb)
-  return rgb_ != NULL ? *rgb_ : *default_instance_->rgb_;
-}
-::config::RGB* SpecialDay::mutable_rgb() {
-  set_has_rgb();
-  if (rgb_ == NULL) {
-    rgb_ = new ::config::RGB;
+  static void set_has_green(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
   }
-  // @@protoc_insertion_point(field_mutable:config.SpecialDay.rgb)
-  return rgb_;
-}
-::config::RGB* SpecialDay::release_rgb() {
-  // @@protoc_insertion_point(field_release:config.SpecialDay.rgb)
-  clear_has_rgb();
-  ::config::RGB* temp = rgb_;
-  rgb_ = NULL;
-  return temp;
-}
-void SpecialDay::set_allocated_rgb(::config::RGB* rgb) {
-  delete rgb_;
-  rgb_ = rgb;
-  if (rgb) {
-    set_has_rgb();
-  } else {
-    clear_has_rgb();
+  static void set_has_blue(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
   }
-  // @@protoc_insertion_point(field_set_allocated:config.SpecialDay.rgb)
-}
-
-#endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
-
-// ===================================================================
-
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int RGB::kRedFieldNumber;
-const int RGB::kGreenFieldNumber;
-const int RGB::kBlueFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
-
-RGB::RGB()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:config.RGB)
-}
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000007) ^ 0x00000007) != 0;
+  }
+};
 
-void RGB::InitAsDefaultInstance() {
+RGB::RGB(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:config.RGB)
 }
-
 RGB::RGB(const RGB& from)
-  : ::google::protobuf::Message(),
-    _internal_metadata_(NULL) {
-  SharedCtor();
-  MergeFrom(from);
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  RGB* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.red_){}
+    , decltype(_impl_.green_){}
+    , decltype(_impl_.blue_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.red_, &from._impl_.red_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.blue_) -
+    reinterpret_cast<char*>(&_impl_.red_)) + sizeof(_impl_.blue_));
   // @@protoc_insertion_point(copy_constructor:config.RGB)
 }
 
-void RGB::SharedCtor() {
-  _cached_size_ = 0;
-  red_ = 0;
-  green_ = 0;
-  blue_ = 0;
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+inline void RGB::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.red_){0}
+    , decltype(_impl_.green_){0}
+    , decltype(_impl_.blue_){0}
+  };
 }
 
 RGB::~RGB() {
   // @@protoc_insertion_point(destructor:config.RGB)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void RGB::SharedDtor() {
-  if (this != default_instance_) {
-  }
+inline void RGB::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
 }
 
 void RGB::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* RGB::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return RGB_descriptor_;
-}
-
-const RGB& RGB::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_config_2eproto();
-  return *default_instance_;
-}
-
-RGB* RGB::default_instance_ = NULL;
-
-RGB* RGB::New(::google::protobuf::Arena* arena) const {
-  RGB* n = new RGB;
-  if (arena != NULL) {
-    arena->Own(n);
-  }
-  return n;
+  _impl_._cached_size_.Set(size);
 }
 
 void RGB::Clear() {
 // @@protoc_insertion_point(message_clear_start:config.RGB)
-#if defined(__clang__)
-#define ZR_HELPER_(f) \
-  _Pragma("clang diagnostic push") \
-  _Pragma("clang diagnostic ignored \"-Winvalid-offsetof\"") \
-  __builtin_offsetof(RGB, f) \
-  _Pragma("clang diagnostic pop")
-#else
-#define ZR_HELPER_(f) reinterpret_cast<char*>(\
-  &reinterpret_cast<RGB*>(16)->f)
-#endif
-
-#define ZR_(first, last) do {\
-  ::memset(&first, 0,\
-           ZR_HELPER_(last) - ZR_HELPER_(first) + sizeof(last));\
-} while (0)
-
-  ZR_(red_, blue_);
-
-#undef ZR_HELPER_
-#undef ZR_
-
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  if (_internal_metadata_.have_unknown_fields()) {
-    mutable_unknown_fields()->Clear();
-  }
-}
-
-bool RGB::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:config.RGB)
-  for (;;) {
-    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoff(127);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    ::memset(&_impl_.red_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.blue_) -
+        reinterpret_cast<char*>(&_impl_.red_)) + sizeof(_impl_.blue_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* RGB::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // required int32 red = 1;
-      case 1: {
-        if (tag == 8) {
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 input, &red_)));
-          set_has_red();
-        } else {
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_red(&has_bits);
+          _impl_.red_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectTag(16)) goto parse_green;
-        break;
-      }
-
+        continue;
       // required int32 green = 2;
-      case 2: {
-        if (tag == 16) {
-         parse_green:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 input, &green_)));
-          set_has_green();
-        } else {
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_green(&has_bits);
+          _impl_.green_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectTag(24)) goto parse_blue;
-        break;
-      }
-
+        continue;
       // required int32 blue = 3;
-      case 3: {
-        if (tag == 24) {
-         parse_blue:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 input, &blue_)));
-          set_has_blue();
-        } else {
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_blue(&has_bits);
+          _impl_.blue_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectAtEnd()) goto success;
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0 ||
-            ::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
-    }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:config.RGB)
-  return true;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:config.RGB)
-  return false;
-#undef DO_
-}
-
-void RGB::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:config.RGB)
-  // required int32 red = 1;
-  if (has_red()) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt32(1, this->red(), output);
-  }
-
-  // required int32 green = 2;
-  if (has_green()) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt32(2, this->green(), output);
-  }
-
-  // required int32 blue = 3;
-  if (has_blue()) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt32(3, this->blue(), output);
-  }
-
-  if (_internal_metadata_.have_unknown_fields()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
-  }
-  // @@protoc_insertion_point(serialize_end:config.RGB)
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-::google::protobuf::uint8* RGB::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
+uint8_t* RGB::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:config.RGB)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
   // required int32 red = 1;
-  if (has_red()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(1, this->red(), target);
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_red(), target);
   }
 
   // required int32 green = 2;
-  if (has_green()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(2, this->green(), target);
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_green(), target);
   }
 
   // required int32 blue = 3;
-  if (has_blue()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(3, this->blue(), target);
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_blue(), target);
   }
 
-  if (_internal_metadata_.have_unknown_fields()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:config.RGB)
   return target;
 }
 
-int RGB::RequiredFieldsByteSizeFallback() const {
+size_t RGB::RequiredFieldsByteSizeFallback() const {
 // @@protoc_insertion_point(required_fields_byte_size_fallback_start:config.RGB)
-  int total_size = 0;
+  size_t total_size = 0;
 
-  if (has_red()) {
+  if (_internal_has_red()) {
     // required int32 red = 1;
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::Int32Size(
-        this->red());
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_red());
   }
 
-  if (has_green()) {
+  if (_internal_has_green()) {
     // required int32 green = 2;
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::Int32Size(
-        this->green());
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_green());
   }
 
-  if (has_blue()) {
+  if (_internal_has_blue()) {
     // required int32 blue = 3;
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::Int32Size(
-        this->blue());
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_blue());
   }
 
   return total_size;
 }
-int RGB::ByteSize() const {
+size_t RGB::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:config.RGB)
-  int total_size = 0;
+  size_t total_size = 0;
 
-  if (((_has_bits_[0] & 0x00000007) ^ 0x00000007) == 0) {  // All required fields are present.
+  if (((_impl_._has_bits_[0] & 0x00000007) ^ 0x00000007) == 0) {  // All required fields are present.
     // required int32 red = 1;
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::Int32Size(
-        this->red());
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_red());
 
     // required int32 green = 2;
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::Int32Size(
-        this->green());
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_green());
 
     // required int32 blue = 3;
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::Int32Size(
-        this->blue());
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_blue());
 
   } else {
     total_size += RequiredFieldsByteSizeFallback();
   }
-  if (_internal_metadata_.have_unknown_fields()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
-  }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
-}
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
-void RGB::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:config.RGB)
-  if (GOOGLE_PREDICT_FALSE(&from == this)) {
-    ::google::protobuf::internal::MergeFromFail(__FILE__, __LINE__);
-  }
-  const RGB* source = 
-      ::google::protobuf::internal::DynamicCastToGenerated<const RGB>(
-          &from);
-  if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:config.RGB)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:config.RGB)
-    MergeFrom(*source);
-  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void RGB::MergeFrom(const RGB& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:config.RGB)
-  if (GOOGLE_PREDICT_FALSE(&from == this)) {
-    ::google::protobuf::internal::MergeFromFail(__FILE__, __LINE__);
-  }
-  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_red()) {
-      set_red(from.red());
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData RGB::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    RGB::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*RGB::GetClassData() const { return &_class_data_; }
+
+
+void RGB::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<RGB*>(&to_msg);
+  auto& from = static_cast<const RGB&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:config.RGB)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.red_ = from._impl_.red_;
     }
-    if (from.has_green()) {
-      set_green(from.green());
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.green_ = from._impl_.green_;
     }
-    if (from.has_blue()) {
-      set_blue(from.blue());
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.blue_ = from._impl_.blue_;
     }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
   }
-  if (from._internal_metadata_.have_unknown_fields()) {
-    mutable_unknown_fields()->MergeFrom(from.unknown_fields());
-  }
-}
-
-void RGB::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:config.RGB)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void RGB::CopyFrom(const RGB& from) {
@@ -3290,111 +2388,731 @@ void RGB::CopyFrom(const RGB& from) {
 }
 
 bool RGB::IsInitialized() const {
-  if ((_has_bits_[0] & 0x00000007) != 0x00000007) return false;
-
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
   return true;
 }
 
-void RGB::Swap(RGB* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void RGB::InternalSwap(RGB* other) {
-  std::swap(red_, other->red_);
-  std::swap(green_, other->green_);
-  std::swap(blue_, other->blue_);
-  std::swap(_has_bits_[0], other->_has_bits_[0]);
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  std::swap(_cached_size_, other->_cached_size_);
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(RGB, _impl_.blue_)
+      + sizeof(RGB::_impl_.blue_)
+      - PROTOBUF_FIELD_OFFSET(RGB, _impl_.red_)>(
+          reinterpret_cast<char*>(&_impl_.red_),
+          reinterpret_cast<char*>(&other->_impl_.red_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata RGB::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_config_2eproto_getter, &descriptor_table_config_2eproto_once,
+      file_level_metadata_config_2eproto[2]);
+}
+
+// ===================================================================
+
+class HolidayRule::_Internal {
+ public:
+  using HasBits = decltype(std::declval<HolidayRule>()._impl_._has_bits_);
+  static void set_has_name(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_month(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_day(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_wday(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_week(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_saturday_to_friday(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static void set_has_sunday_to_monday(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000002) ^ 0x00000002) != 0;
+  }
+};
+
+HolidayRule::HolidayRule(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:config.HolidayRule)
+}
+HolidayRule::HolidayRule(const HolidayRule& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  HolidayRule* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.month_){}
+    , decltype(_impl_.day_){}
+    , decltype(_impl_.wday_){}
+    , decltype(_impl_.week_){}
+    , decltype(_impl_.saturday_to_friday_){}
+    , decltype(_impl_.sunday_to_monday_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_name()) {
+    _this->_impl_.name_.Set(from._internal_name(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.month_, &from._impl_.month_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.sunday_to_monday_) -
+    reinterpret_cast<char*>(&_impl_.month_)) + sizeof(_impl_.sunday_to_monday_));
+  // @@protoc_insertion_point(copy_constructor:config.HolidayRule)
+}
+
+inline void HolidayRule::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.month_){0}
+    , decltype(_impl_.day_){0}
+    , decltype(_impl_.wday_){0}
+    , decltype(_impl_.week_){0}
+    , decltype(_impl_.saturday_to_friday_){false}
+    , decltype(_impl_.sunday_to_monday_){false}
+  };
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+HolidayRule::~HolidayRule() {
+  // @@protoc_insertion_point(destructor:config.HolidayRule)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void HolidayRule::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.name_.Destroy();
 }
 
-::google::protobuf::Metadata RGB::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = RGB_descriptor_;
-  metadata.reflection = RGB_reflection_;
-  return metadata;
+void HolidayRule::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
 
-#if PROTOBUF_INLINE_NOT_IN_HEADERS
-// RGB
+void HolidayRule::Clear() {
+// @@protoc_insertion_point(message_clear_start:config.HolidayRule)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
-// required int32 red = 1;
-bool RGB::has_red() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.name_.ClearNonDefaultToEmpty();
+  }
+  if (cached_has_bits & 0x0000007eu) {
+    ::memset(&_impl_.month_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.sunday_to_monday_) -
+        reinterpret_cast<char*>(&_impl_.month_)) + sizeof(_impl_.sunday_to_monday_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
-void RGB::set_has_red() {
-  _has_bits_[0] |= 0x00000001u;
+
+const char* HolidayRule::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional string name = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "config.HolidayRule.name");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // required int32 month = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_month(&has_bits);
+          _impl_.month_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 day = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_day(&has_bits);
+          _impl_.day_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 wday = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _Internal::set_has_wday(&has_bits);
+          _impl_.wday_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 week = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _Internal::set_has_week(&has_bits);
+          _impl_.week_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool saturday_to_friday = 6 [default = false];
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _Internal::set_has_saturday_to_friday(&has_bits);
+          _impl_.saturday_to_friday_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool sunday_to_monday = 7 [default = false];
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _Internal::set_has_sunday_to_monday(&has_bits);
+          _impl_.sunday_to_monday_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
-void RGB::clear_has_red() {
-  _has_bits_[0] &= ~0x00000001u;
+
+uint8_t* HolidayRule::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:config.HolidayRule)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional string name = 1;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "config.HolidayRule.name");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_name(), target);
+  }
+
+  // required int32 month = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_month(), target);
+  }
+
+  // optional int32 day = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_day(), target);
+  }
+
+  // optional int32 wday = 4;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(4, this->_internal_wday(), target);
+  }
+
+  // optional int32 week = 5;
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(5, this->_internal_week(), target);
+  }
+
+  // optional bool saturday_to_friday = 6 [default = false];
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(6, this->_internal_saturday_to_friday(), target);
+  }
+
+  // optional bool sunday_to_monday = 7 [default = false];
+  if (cached_has_bits & 0x00000040u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(7, this->_internal_sunday_to_monday(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:config.HolidayRule)
+  return target;
 }
-void RGB::clear_red() {
-  red_ = 0;
-  clear_has_red();
+
+size_t HolidayRule::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:config.HolidayRule)
+  size_t total_size = 0;
+
+  // required int32 month = 2;
+  if (_internal_has_month()) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_month());
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // optional string name = 1;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_name());
+  }
+
+  if (cached_has_bits & 0x0000007cu) {
+    // optional int32 day = 3;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_day());
+    }
+
+    // optional int32 wday = 4;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_wday());
+    }
+
+    // optional int32 week = 5;
+    if (cached_has_bits & 0x00000010u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_week());
+    }
+
+    // optional bool saturday_to_friday = 6 [default = false];
+    if (cached_has_bits & 0x00000020u) {
+      total_size += 1 + 1;
+    }
+
+    // optional bool sunday_to_monday = 7 [default = false];
+    if (cached_has_bits & 0x00000040u) {
+      total_size += 1 + 1;
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
- ::google::protobuf::int32 RGB::red() const {
-  // @@protoc_insertion_point(field_get:config.RGB.red)
-  return red_;
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData HolidayRule::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    HolidayRule::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*HolidayRule::GetClassData() const { return &_class_data_; }
+
+
+void HolidayRule::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<HolidayRule*>(&to_msg);
+  auto& from = static_cast<const HolidayRule&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:config.HolidayRule)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000007fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_name(from._internal_name());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.month_ = from._impl_.month_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.day_ = from._impl_.day_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.wday_ = from._impl_.wday_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.week_ = from._impl_.week_;
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.saturday_to_friday_ = from._impl_.saturday_to_friday_;
+    }
+    if (cached_has_bits & 0x00000040u) {
+      _this->_impl_.sunday_to_monday_ = from._impl_.sunday_to_monday_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
- void RGB::set_red(::google::protobuf::int32 value) {
-  set_has_red();
-  red_ = value;
-  // @@protoc_insertion_point(field_set:config.RGB.red)
+
+void HolidayRule::CopyFrom(const HolidayRule& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:config.HolidayRule)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
 }
 
-// required int32 green = 2;
-bool RGB::has_green() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
+bool HolidayRule::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
 }
-void RGB::set_has_green() {
-  _has_bits_[0] |= 0x00000002u;
+
+void HolidayRule::InternalSwap(HolidayRule* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(HolidayRule, _impl_.sunday_to_monday_)
+      + sizeof(HolidayRule::_impl_.sunday_to_monday_)
+      - PROTOBUF_FIELD_OFFSET(HolidayRule, _impl_.month_)>(
+          reinterpret_cast<char*>(&_impl_.month_),
+          reinterpret_cast<char*>(&other->_impl_.month_));
 }
-void RGB::clear_has_green() {
-  _has_bits_[0] &= ~0x00000002u;
+
+::PROTOBUF_NAMESPACE_ID::Metadata HolidayRule::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_config_2eproto_getter, &descriptor_table_config_2eproto_once,
+      file_level_metadata_config_2eproto[3]);
 }
-void RGB::clear_green() {
-  green_ = 0;
-  clear_has_green();
+
+// ===================================================================
+
+class CalendarBatch::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CalendarBatch>()._impl_._has_bits_);
+  static void set_has_jobs(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+CalendarBatch::CalendarBatch(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:config.CalendarBatch)
+}
+CalendarBatch::CalendarBatch(const CalendarBatch& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CalendarBatch* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.config_file_){from._impl_.config_file_}
+    , decltype(_impl_.config_){from._impl_.config_}
+    , decltype(_impl_.jobs_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.jobs_ = from._impl_.jobs_;
+  // @@protoc_insertion_point(copy_constructor:config.CalendarBatch)
+}
+
+inline void CalendarBatch::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.config_file_){arena}
+    , decltype(_impl_.config_){arena}
+    , decltype(_impl_.jobs_){1}
+  };
 }
- ::google::protobuf::int32 RGB::green() const {
-  // @@protoc_insertion_point(field_get:config.RGB.green)
-  return green_;
+
+CalendarBatch::~CalendarBatch() {
+  // @@protoc_insertion_point(destructor:config.CalendarBatch)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
 }
- void RGB::set_green(::google::protobuf::int32 value) {
-  set_has_green();
-  green_ = value;
-  // @@protoc_insertion_point(field_set:config.RGB.green)
+
+inline void CalendarBatch::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.config_file_.~RepeatedPtrField();
+  _impl_.config_.~RepeatedPtrField();
+}
+
+void CalendarBatch::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CalendarBatch::Clear() {
+// @@protoc_insertion_point(message_clear_start:config.CalendarBatch)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.config_file_.Clear();
+  _impl_.config_.Clear();
+  _impl_.jobs_ = 1;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CalendarBatch::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated string config_file = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_config_file();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            #ifndef NDEBUG
+            ::_pbi::VerifyUTF8(str, "config.CalendarBatch.config_file");
+            #endif  // !NDEBUG
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .config.CalendarConfig config = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_config(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 jobs = 3 [default = 1];
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_jobs(&has_bits);
+          _impl_.jobs_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-// required int32 blue = 3;
-bool RGB::has_blue() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
+uint8_t* CalendarBatch::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:config.CalendarBatch)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated string config_file = 1;
+  for (int i = 0, n = this->_internal_config_file_size(); i < n; i++) {
+    const auto& s = this->_internal_config_file(i);
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      s.data(), static_cast<int>(s.length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "config.CalendarBatch.config_file");
+    target = stream->WriteString(1, s, target);
+  }
+
+  // repeated .config.CalendarConfig config = 2;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_config_size()); i < n; i++) {
+    const auto& repfield = this->_internal_config(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(2, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional int32 jobs = 3 [default = 1];
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_jobs(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:config.CalendarBatch)
+  return target;
 }
-void RGB::set_has_blue() {
-  _has_bits_[0] |= 0x00000004u;
+
+size_t CalendarBatch::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:config.CalendarBatch)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated string config_file = 1;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.config_file_.size());
+  for (int i = 0, n = _impl_.config_file_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      _impl_.config_file_.Get(i));
+  }
+
+  // repeated .config.CalendarConfig config = 2;
+  total_size += 1UL * this->_internal_config_size();
+  for (const auto& msg : this->_impl_.config_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // optional int32 jobs = 3 [default = 1];
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_jobs());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
-void RGB::clear_has_blue() {
-  _has_bits_[0] &= ~0x00000004u;
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CalendarBatch::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CalendarBatch::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CalendarBatch::GetClassData() const { return &_class_data_; }
+
+
+void CalendarBatch::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CalendarBatch*>(&to_msg);
+  auto& from = static_cast<const CalendarBatch&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:config.CalendarBatch)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.config_file_.MergeFrom(from._impl_.config_file_);
+  _this->_impl_.config_.MergeFrom(from._impl_.config_);
+  if (from._internal_has_jobs()) {
+    _this->_internal_set_jobs(from._internal_jobs());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
-void RGB::clear_blue() {
-  blue_ = 0;
-  clear_has_blue();
+
+void CalendarBatch::CopyFrom(const CalendarBatch& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:config.CalendarBatch)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
 }
- ::google::protobuf::int32 RGB::blue() const {
-  // @@protoc_insertion_point(field_get:config.RGB.blue)
-  return blue_;
+
+bool CalendarBatch::IsInitialized() const {
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(_impl_.config_))
+    return false;
+  return true;
 }
- void RGB::set_blue(::google::protobuf::int32 value) {
-  set_has_blue();
-  blue_ = value;
-  // @@protoc_insertion_point(field_set:config.RGB.blue)
+
+void CalendarBatch::InternalSwap(CalendarBatch* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.config_file_.InternalSwap(&other->_impl_.config_file_);
+  _impl_.config_.InternalSwap(&other->_impl_.config_);
+  swap(_impl_.jobs_, other->_impl_.jobs_);
 }
 
-#endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
+::PROTOBUF_NAMESPACE_ID::Metadata CalendarBatch::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_config_2eproto_getter, &descriptor_table_config_2eproto_once,
+      file_level_metadata_config_2eproto[4]);
+}
 
 // @@protoc_insertion_point(namespace_scope)
-
 }  // namespace config
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::config::CalendarConfig*
+Arena::CreateMaybeMessage< ::config::CalendarConfig >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::config::CalendarConfig >(arena);
+}
+template<> PROTOBUF_NOINLINE ::config::SpecialDay*
+Arena::CreateMaybeMessage< ::config::SpecialDay >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::config::SpecialDay >(arena);
+}
+template<> PROTOBUF_NOINLINE ::config::RGB*
+Arena::CreateMaybeMessage< ::config::RGB >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::config::RGB >(arena);
+}
+template<> PROTOBUF_NOINLINE ::config::HolidayRule*
+Arena::CreateMaybeMessage< ::config::HolidayRule >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::config::HolidayRule >(arena);
+}
+template<> PROTOBUF_NOINLINE ::config::CalendarBatch*
+Arena::CreateMaybeMessage< ::config::CalendarBatch >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::config::CalendarBatch >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
 
 // @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
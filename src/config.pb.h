@@ -1,1479 +1,3032 @@
 // Generated by the protocol buffer compiler.  DO NOT EDIT!
 // source: config.proto
 
-#ifndef PROTOBUF_config_2eproto__INCLUDED
-#define PROTOBUF_config_2eproto__INCLUDED
+#ifndef GOOGLE_PROTOBUF_INCLUDED_config_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_config_2eproto
 
+#include <limits>
 #include <string>
 
-#include <google/protobuf/stubs/common.h>
-
-#if GOOGLE_PROTOBUF_VERSION < 3000000
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
 #error This file was generated by a newer version of protoc which is
-#error incompatible with your Protocol Buffer headers.  Please update
+#error incompatible with your Protocol Buffer headers. Please update
 #error your headers.
 #endif
-#if 3000000 < GOOGLE_PROTOBUF_MIN_PROTOC_VERSION
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
 #error This file was generated by an older version of protoc which is
-#error incompatible with your Protocol Buffer headers.  Please
+#error incompatible with your Protocol Buffer headers. Please
 #error regenerate this file with a newer version of protoc.
 #endif
 
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
 #include <google/protobuf/arena.h>
 #include <google/protobuf/arenastring.h>
 #include <google/protobuf/generated_message_util.h>
-#include <google/protobuf/metadata.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
 #include <google/protobuf/message.h>
-#include <google/protobuf/repeated_field.h>
-#include <google/protobuf/extension_set.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
 #include <google/protobuf/generated_enum_reflection.h>
 #include <google/protobuf/unknown_field_set.h>
 // @@protoc_insertion_point(includes)
-
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_config_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_config_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_config_2eproto;
 namespace config {
-
-// Internal implementation detail -- do not call these.
-void protobuf_AddDesc_config_2eproto();
-void protobuf_AssignDesc_config_2eproto();
-void protobuf_ShutdownFile_config_2eproto();
-
+class CalendarBatch;
+struct CalendarBatchDefaultTypeInternal;
+extern CalendarBatchDefaultTypeInternal _CalendarBatch_default_instance_;
 class CalendarConfig;
+struct CalendarConfigDefaultTypeInternal;
+extern CalendarConfigDefaultTypeInternal _CalendarConfig_default_instance_;
+class HolidayRule;
+struct HolidayRuleDefaultTypeInternal;
+extern HolidayRuleDefaultTypeInternal _HolidayRule_default_instance_;
 class RGB;
+struct RGBDefaultTypeInternal;
+extern RGBDefaultTypeInternal _RGB_default_instance_;
 class SpecialDay;
+struct SpecialDayDefaultTypeInternal;
+extern SpecialDayDefaultTypeInternal _SpecialDay_default_instance_;
+}  // namespace config
+PROTOBUF_NAMESPACE_OPEN
+template<> ::config::CalendarBatch* Arena::CreateMaybeMessage<::config::CalendarBatch>(Arena*);
+template<> ::config::CalendarConfig* Arena::CreateMaybeMessage<::config::CalendarConfig>(Arena*);
+template<> ::config::HolidayRule* Arena::CreateMaybeMessage<::config::HolidayRule>(Arena*);
+template<> ::config::RGB* Arena::CreateMaybeMessage<::config::RGB>(Arena*);
+template<> ::config::SpecialDay* Arena::CreateMaybeMessage<::config::SpecialDay>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace config {
 
-enum OutputType {
+enum OutputType : int {
   SVG = 0,
   PDF = 1,
   PNG = 2
 };
 bool OutputType_IsValid(int value);
-const OutputType OutputType_MIN = SVG;
-const OutputType OutputType_MAX = PNG;
-const int OutputType_ARRAYSIZE = OutputType_MAX + 1;
-
-const ::google::protobuf::EnumDescriptor* OutputType_descriptor();
-inline const ::std::string& OutputType_Name(OutputType value) {
-  return ::google::protobuf::internal::NameOfEnum(
-    OutputType_descriptor(), value);
+constexpr OutputType OutputType_MIN = SVG;
+constexpr OutputType OutputType_MAX = PNG;
+constexpr int OutputType_ARRAYSIZE = OutputType_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* OutputType_descriptor();
+template<typename T>
+inline const std::string& OutputType_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, OutputType>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function OutputType_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    OutputType_descriptor(), enum_t_value);
 }
 inline bool OutputType_Parse(
-    const ::std::string& name, OutputType* value) {
-  return ::google::protobuf::internal::ParseNamedEnum<OutputType>(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, OutputType* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<OutputType>(
     OutputType_descriptor(), name, value);
 }
 // ===================================================================
 
-class CalendarConfig : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:config.CalendarConfig) */ {
+class CalendarConfig final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:config.CalendarConfig) */ {
  public:
-  CalendarConfig();
-  virtual ~CalendarConfig();
+  inline CalendarConfig() : CalendarConfig(nullptr) {}
+  ~CalendarConfig() override;
+  explicit PROTOBUF_CONSTEXPR CalendarConfig(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   CalendarConfig(const CalendarConfig& from);
+  CalendarConfig(CalendarConfig&& from) noexcept
+    : CalendarConfig() {
+    *this = ::std::move(from);
+  }
 
   inline CalendarConfig& operator=(const CalendarConfig& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _internal_metadata_.unknown_fields();
+  inline CalendarConfig& operator=(CalendarConfig&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return _internal_metadata_.mutable_unknown_fields();
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const CalendarConfig& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CalendarConfig& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CalendarConfig* internal_default_instance() {
+    return reinterpret_cast<const CalendarConfig*>(
+               &_CalendarConfig_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
 
-  void Swap(CalendarConfig* other);
+  friend void swap(CalendarConfig& a, CalendarConfig& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CalendarConfig* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CalendarConfig* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline CalendarConfig* New() const { return New(NULL); }
-
-  CalendarConfig* New(::google::protobuf::Arena* arena) const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+  CalendarConfig* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CalendarConfig>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const CalendarConfig& from);
-  void MergeFrom(const CalendarConfig& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
-    return InternalSerializeWithCachedSizesToArray(false, output);
-  }
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CalendarConfig& from) {
+    CalendarConfig::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
   void InternalSwap(CalendarConfig* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return _internal_metadata_.arena();
-  }
-  inline void* MaybeArenaPtr() const {
-    return _internal_metadata_.raw_arena_ptr();
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "config.CalendarConfig";
   }
+  protected:
+  explicit CalendarConfig(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
-  // optional int32 num_years = 1 [default = 30];
-  bool has_num_years() const;
-  void clear_num_years();
-  static const int kNumYearsFieldNumber = 1;
-  ::google::protobuf::int32 num_years() const;
-  void set_num_years(::google::protobuf::int32 value);
-
-  // optional int32 first_month = 2 [default = 1];
-  bool has_first_month() const;
-  void clear_first_month();
-  static const int kFirstMonthFieldNumber = 2;
-  ::google::protobuf::int32 first_month() const;
-  void set_first_month(::google::protobuf::int32 value);
-
-  // optional int32 num_months = 3 [default = 12];
-  bool has_num_months() const;
-  void clear_num_months();
-  static const int kNumMonthsFieldNumber = 3;
-  ::google::protobuf::int32 num_months() const;
-  void set_num_months(::google::protobuf::int32 value);
-
+  enum : int {
+    kSpecialDayFieldNumber = 4,
+    kHolidayFieldNumber = 24,
+    kOutputTypesFieldNumber = 25,
+    kBottomLeftLabelFieldNumber = 16,
+    kBottomRightLabelFieldNumber = 17,
+    kHeaderFontFamilyFieldNumber = 18,
+    kNumberFontFamilyFieldNumber = 19,
+    kQuoteFontFamilyFieldNumber = 20,
+    kOutputNameFieldNumber = 26,
+    kRgbHeaderFieldNumber = 12,
+    kRgbHeaderSundayFieldNumber = 13,
+    kRgbMonthLineFieldNumber = 14,
+    kRgbHolidayFieldNumber = 15,
+    kCellSizeFieldNumber = 5,
+    kCellMarginFieldNumber = 6,
+    kFontSizeFieldNumber = 7,
+    kBiggerFontSizeFieldNumber = 8,
+    kLineWidthFieldNumber = 9,
+    kMonthLabelHeightFieldNumber = 10,
+    kYearLabelWidthFieldNumber = 11,
+    kVerticalDottedLineXFieldNumber = 22,
+    kDottedLineFieldNumber = 21,
+    kOutputTypeFieldNumber = 23,
+    kTileHeightFieldNumber = 28,
+    kStartYearFieldNumber = 29,
+    kShareSvgPathsFieldNumber = 30,
+    kNumYearsFieldNumber = 1,
+    kFirstMonthFieldNumber = 2,
+    kNumMonthsFieldNumber = 3,
+    kRenderThreadsFieldNumber = 27,
+  };
   // repeated .config.SpecialDay special_day = 4;
   int special_day_size() const;
+  private:
+  int _internal_special_day_size() const;
+  public:
   void clear_special_day();
-  static const int kSpecialDayFieldNumber = 4;
-  const ::config::SpecialDay& special_day(int index) const;
   ::config::SpecialDay* mutable_special_day(int index);
-  ::config::SpecialDay* add_special_day();
-  ::google::protobuf::RepeatedPtrField< ::config::SpecialDay >*
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::config::SpecialDay >*
       mutable_special_day();
-  const ::google::protobuf::RepeatedPtrField< ::config::SpecialDay >&
+  private:
+  const ::config::SpecialDay& _internal_special_day(int index) const;
+  ::config::SpecialDay* _internal_add_special_day();
+  public:
+  const ::config::SpecialDay& special_day(int index) const;
+  ::config::SpecialDay* add_special_day();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::config::SpecialDay >&
       special_day() const;
 
+  // repeated .config.HolidayRule holiday = 24;
+  int holiday_size() const;
+  private:
+  int _internal_holiday_size() const;
+  public:
+  void clear_holiday();
+  ::config::HolidayRule* mutable_holiday(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::config::HolidayRule >*
+      mutable_holiday();
+  private:
+  const ::config::HolidayRule& _internal_holiday(int index) const;
+  ::config::HolidayRule* _internal_add_holiday();
+  public:
+  const ::config::HolidayRule& holiday(int index) const;
+  ::config::HolidayRule* add_holiday();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::config::HolidayRule >&
+      holiday() const;
+
+  // repeated .config.OutputType output_types = 25;
+  int output_types_size() const;
+  private:
+  int _internal_output_types_size() const;
+  public:
+  void clear_output_types();
+  private:
+  ::config::OutputType _internal_output_types(int index) const;
+  void _internal_add_output_types(::config::OutputType value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField<int>* _internal_mutable_output_types();
+  public:
+  ::config::OutputType output_types(int index) const;
+  void set_output_types(int index, ::config::OutputType value);
+  void add_output_types(::config::OutputType value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField<int>& output_types() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField<int>* mutable_output_types();
+
+  // optional string bottom_left_label = 16;
+  bool has_bottom_left_label() const;
+  private:
+  bool _internal_has_bottom_left_label() const;
+  public:
+  void clear_bottom_left_label();
+  const std::string& bottom_left_label() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_bottom_left_label(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_bottom_left_label();
+  PROTOBUF_NODISCARD std::string* release_bottom_left_label();
+  void set_allocated_bottom_left_label(std::string* bottom_left_label);
+  private:
+  const std::string& _internal_bottom_left_label() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_bottom_left_label(const std::string& value);
+  std::string* _internal_mutable_bottom_left_label();
+  public:
+
+  // optional string bottom_right_label = 17;
+  bool has_bottom_right_label() const;
+  private:
+  bool _internal_has_bottom_right_label() const;
+  public:
+  void clear_bottom_right_label();
+  const std::string& bottom_right_label() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_bottom_right_label(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_bottom_right_label();
+  PROTOBUF_NODISCARD std::string* release_bottom_right_label();
+  void set_allocated_bottom_right_label(std::string* bottom_right_label);
+  private:
+  const std::string& _internal_bottom_right_label() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_bottom_right_label(const std::string& value);
+  std::string* _internal_mutable_bottom_right_label();
+  public:
+
+  // optional string header_font_family = 18;
+  bool has_header_font_family() const;
+  private:
+  bool _internal_has_header_font_family() const;
+  public:
+  void clear_header_font_family();
+  const std::string& header_font_family() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_header_font_family(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_header_font_family();
+  PROTOBUF_NODISCARD std::string* release_header_font_family();
+  void set_allocated_header_font_family(std::string* header_font_family);
+  private:
+  const std::string& _internal_header_font_family() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_header_font_family(const std::string& value);
+  std::string* _internal_mutable_header_font_family();
+  public:
+
+  // optional string number_font_family = 19;
+  bool has_number_font_family() const;
+  private:
+  bool _internal_has_number_font_family() const;
+  public:
+  void clear_number_font_family();
+  const std::string& number_font_family() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_number_font_family(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_number_font_family();
+  PROTOBUF_NODISCARD std::string* release_number_font_family();
+  void set_allocated_number_font_family(std::string* number_font_family);
+  private:
+  const std::string& _internal_number_font_family() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_number_font_family(const std::string& value);
+  std::string* _internal_mutable_number_font_family();
+  public:
+
+  // optional string quote_font_family = 20;
+  bool has_quote_font_family() const;
+  private:
+  bool _internal_has_quote_font_family() const;
+  public:
+  void clear_quote_font_family();
+  const std::string& quote_font_family() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_quote_font_family(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_quote_font_family();
+  PROTOBUF_NODISCARD std::string* release_quote_font_family();
+  void set_allocated_quote_font_family(std::string* quote_font_family);
+  private:
+  const std::string& _internal_quote_font_family() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_quote_font_family(const std::string& value);
+  std::string* _internal_mutable_quote_font_family();
+  public:
+
+  // optional string output_name = 26 [default = "example"];
+  bool has_output_name() const;
+  private:
+  bool _internal_has_output_name() const;
+  public:
+  void clear_output_name();
+  const std::string& output_name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_output_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_output_name();
+  PROTOBUF_NODISCARD std::string* release_output_name();
+  void set_allocated_output_name(std::string* output_name);
+  private:
+  const std::string& _internal_output_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_output_name(const std::string& value);
+  std::string* _internal_mutable_output_name();
+  public:
+
+  // optional .config.RGB rgb_header = 12;
+  bool has_rgb_header() const;
+  private:
+  bool _internal_has_rgb_header() const;
+  public:
+  void clear_rgb_header();
+  const ::config::RGB& rgb_header() const;
+  PROTOBUF_NODISCARD ::config::RGB* release_rgb_header();
+  ::config::RGB* mutable_rgb_header();
+  void set_allocated_rgb_header(::config::RGB* rgb_header);
+  private:
+  const ::config::RGB& _internal_rgb_header() const;
+  ::config::RGB* _internal_mutable_rgb_header();
+  public:
+  void unsafe_arena_set_allocated_rgb_header(
+      ::config::RGB* rgb_header);
+  ::config::RGB* unsafe_arena_release_rgb_header();
+
+  // optional .config.RGB rgb_header_sunday = 13;
+  bool has_rgb_header_sunday() const;
+  private:
+  bool _internal_has_rgb_header_sunday() const;
+  public:
+  void clear_rgb_header_sunday();
+  const ::config::RGB& rgb_header_sunday() const;
+  PROTOBUF_NODISCARD ::config::RGB* release_rgb_header_sunday();
+  ::config::RGB* mutable_rgb_header_sunday();
+  void set_allocated_rgb_header_sunday(::config::RGB* rgb_header_sunday);
+  private:
+  const ::config::RGB& _internal_rgb_header_sunday() const;
+  ::config::RGB* _internal_mutable_rgb_header_sunday();
+  public:
+  void unsafe_arena_set_allocated_rgb_header_sunday(
+      ::config::RGB* rgb_header_sunday);
+  ::config::RGB* unsafe_arena_release_rgb_header_sunday();
+
+  // optional .config.RGB rgb_month_line = 14;
+  bool has_rgb_month_line() const;
+  private:
+  bool _internal_has_rgb_month_line() const;
+  public:
+  void clear_rgb_month_line();
+  const ::config::RGB& rgb_month_line() const;
+  PROTOBUF_NODISCARD ::config::RGB* release_rgb_month_line();
+  ::config::RGB* mutable_rgb_month_line();
+  void set_allocated_rgb_month_line(::config::RGB* rgb_month_line);
+  private:
+  const ::config::RGB& _internal_rgb_month_line() const;
+  ::config::RGB* _internal_mutable_rgb_month_line();
+  public:
+  void unsafe_arena_set_allocated_rgb_month_line(
+      ::config::RGB* rgb_month_line);
+  ::config::RGB* unsafe_arena_release_rgb_month_line();
+
+  // optional .config.RGB rgb_holiday = 15;
+  bool has_rgb_holiday() const;
+  private:
+  bool _internal_has_rgb_holiday() const;
+  public:
+  void clear_rgb_holiday();
+  const ::config::RGB& rgb_holiday() const;
+  PROTOBUF_NODISCARD ::config::RGB* release_rgb_holiday();
+  ::config::RGB* mutable_rgb_holiday();
+  void set_allocated_rgb_holiday(::config::RGB* rgb_holiday);
+  private:
+  const ::config::RGB& _internal_rgb_holiday() const;
+  ::config::RGB* _internal_mutable_rgb_holiday();
+  public:
+  void unsafe_arena_set_allocated_rgb_holiday(
+      ::config::RGB* rgb_holiday);
+  ::config::RGB* unsafe_arena_release_rgb_holiday();
+
   // optional double cell_size = 5;
   bool has_cell_size() const;
+  private:
+  bool _internal_has_cell_size() const;
+  public:
   void clear_cell_size();
-  static const int kCellSizeFieldNumber = 5;
   double cell_size() const;
   void set_cell_size(double value);
+  private:
+  double _internal_cell_size() const;
+  void _internal_set_cell_size(double value);
+  public:
 
   // optional double cell_margin = 6;
   bool has_cell_margin() const;
+  private:
+  bool _internal_has_cell_margin() const;
+  public:
   void clear_cell_margin();
-  static const int kCellMarginFieldNumber = 6;
   double cell_margin() const;
   void set_cell_margin(double value);
+  private:
+  double _internal_cell_margin() const;
+  void _internal_set_cell_margin(double value);
+  public:
 
   // optional double font_size = 7;
   bool has_font_size() const;
+  private:
+  bool _internal_has_font_size() const;
+  public:
   void clear_font_size();
-  static const int kFontSizeFieldNumber = 7;
   double font_size() const;
   void set_font_size(double value);
+  private:
+  double _internal_font_size() const;
+  void _internal_set_font_size(double value);
+  public:
 
   // optional double bigger_font_size = 8;
   bool has_bigger_font_size() const;
+  private:
+  bool _internal_has_bigger_font_size() const;
+  public:
   void clear_bigger_font_size();
-  static const int kBiggerFontSizeFieldNumber = 8;
   double bigger_font_size() const;
   void set_bigger_font_size(double value);
+  private:
+  double _internal_bigger_font_size() const;
+  void _internal_set_bigger_font_size(double value);
+  public:
 
   // optional double line_width = 9;
   bool has_line_width() const;
+  private:
+  bool _internal_has_line_width() const;
+  public:
   void clear_line_width();
-  static const int kLineWidthFieldNumber = 9;
   double line_width() const;
   void set_line_width(double value);
+  private:
+  double _internal_line_width() const;
+  void _internal_set_line_width(double value);
+  public:
 
   // optional double month_label_height = 10;
   bool has_month_label_height() const;
+  private:
+  bool _internal_has_month_label_height() const;
+  public:
   void clear_month_label_height();
-  static const int kMonthLabelHeightFieldNumber = 10;
   double month_label_height() const;
   void set_month_label_height(double value);
+  private:
+  double _internal_month_label_height() const;
+  void _internal_set_month_label_height(double value);
+  public:
 
   // optional double year_label_width = 11;
   bool has_year_label_width() const;
+  private:
+  bool _internal_has_year_label_width() const;
+  public:
   void clear_year_label_width();
-  static const int kYearLabelWidthFieldNumber = 11;
   double year_label_width() const;
   void set_year_label_width(double value);
+  private:
+  double _internal_year_label_width() const;
+  void _internal_set_year_label_width(double value);
+  public:
 
-  // optional .config.RGB rgb_header = 12;
-  bool has_rgb_header() const;
-  void clear_rgb_header();
-  static const int kRgbHeaderFieldNumber = 12;
-  const ::config::RGB& rgb_header() const;
-  ::config::RGB* mutable_rgb_header();
-  ::config::RGB* release_rgb_header();
-  void set_allocated_rgb_header(::config::RGB* rgb_header);
-
-  // optional .config.RGB rgb_header_sunday = 13;
-  bool has_rgb_header_sunday() const;
-  void clear_rgb_header_sunday();
-  static const int kRgbHeaderSundayFieldNumber = 13;
-  const ::config::RGB& rgb_header_sunday() const;
-  ::config::RGB* mutable_rgb_header_sunday();
-  ::config::RGB* release_rgb_header_sunday();
-  void set_allocated_rgb_header_sunday(::config::RGB* rgb_header_sunday);
-
-  // optional .config.RGB rgb_month_line = 14;
-  bool has_rgb_month_line() const;
-  void clear_rgb_month_line();
-  static const int kRgbMonthLineFieldNumber = 14;
-  const ::config::RGB& rgb_month_line() const;
-  ::config::RGB* mutable_rgb_month_line();
-  ::config::RGB* release_rgb_month_line();
-  void set_allocated_rgb_month_line(::config::RGB* rgb_month_line);
-
-  // optional .config.RGB rgb_holiday = 15;
-  bool has_rgb_holiday() const;
-  void clear_rgb_holiday();
-  static const int kRgbHolidayFieldNumber = 15;
-  const ::config::RGB& rgb_holiday() const;
-  ::config::RGB* mutable_rgb_holiday();
-  ::config::RGB* release_rgb_holiday();
-  void set_allocated_rgb_holiday(::config::RGB* rgb_holiday);
-
-  // optional string bottom_left_label = 16;
-  bool has_bottom_left_label() const;
-  void clear_bottom_left_label();
-  static const int kBottomLeftLabelFieldNumber = 16;
-  const ::std::string& bottom_left_label() const;
-  void set_bottom_left_label(const ::std::string& value);
-  void set_bottom_left_label(const char* value);
-  void set_bottom_left_label(const char* value, size_t size);
-  ::std::string* mutable_bottom_left_label();
-  ::std::string* release_bottom_left_label();
-  void set_allocated_bottom_left_label(::std::string* bottom_left_label);
-
-  // optional string bottom_right_label = 17;
-  bool has_bottom_right_label() const;
-  void clear_bottom_right_label();
-  static const int kBottomRightLabelFieldNumber = 17;
-  const ::std::string& bottom_right_label() const;
-  void set_bottom_right_label(const ::std::string& value);
-  void set_bottom_right_label(const char* value);
-  void set_bottom_right_label(const char* value, size_t size);
-  ::std::string* mutable_bottom_right_label();
-  ::std::string* release_bottom_right_label();
-  void set_allocated_bottom_right_label(::std::string* bottom_right_label);
-
-  // optional string header_font_family = 18;
-  bool has_header_font_family() const;
-  void clear_header_font_family();
-  static const int kHeaderFontFamilyFieldNumber = 18;
-  const ::std::string& header_font_family() const;
-  void set_header_font_family(const ::std::string& value);
-  void set_header_font_family(const char* value);
-  void set_header_font_family(const char* value, size_t size);
-  ::std::string* mutable_header_font_family();
-  ::std::string* release_header_font_family();
-  void set_allocated_header_font_family(::std::string* header_font_family);
-
-  // optional string number_font_family = 19;
-  bool has_number_font_family() const;
-  void clear_number_font_family();
-  static const int kNumberFontFamilyFieldNumber = 19;
-  const ::std::string& number_font_family() const;
-  void set_number_font_family(const ::std::string& value);
-  void set_number_font_family(const char* value);
-  void set_number_font_family(const char* value, size_t size);
-  ::std::string* mutable_number_font_family();
-  ::std::string* release_number_font_family();
-  void set_allocated_number_font_family(::std::string* number_font_family);
-
-  // optional string quote_font_family = 20;
-  bool has_quote_font_family() const;
-  void clear_quote_font_family();
-  static const int kQuoteFontFamilyFieldNumber = 20;
-  const ::std::string& quote_font_family() const;
-  void set_quote_font_family(const ::std::string& value);
-  void set_quote_font_family(const char* value);
-  void set_quote_font_family(const char* value, size_t size);
-  ::std::string* mutable_quote_font_family();
-  ::std::string* release_quote_font_family();
-  void set_allocated_quote_font_family(::std::string* quote_font_family);
+  // optional double vertical_dotted_line_x = 22;
+  bool has_vertical_dotted_line_x() const;
+  private:
+  bool _internal_has_vertical_dotted_line_x() const;
+  public:
+  void clear_vertical_dotted_line_x();
+  double vertical_dotted_line_x() const;
+  void set_vertical_dotted_line_x(double value);
+  private:
+  double _internal_vertical_dotted_line_x() const;
+  void _internal_set_vertical_dotted_line_x(double value);
+  public:
 
   // optional bool dotted_line = 21 [default = false];
   bool has_dotted_line() const;
+  private:
+  bool _internal_has_dotted_line() const;
+  public:
   void clear_dotted_line();
-  static const int kDottedLineFieldNumber = 21;
   bool dotted_line() const;
   void set_dotted_line(bool value);
-
-  // optional double vertical_dotted_line_x = 22;
-  bool has_vertical_dotted_line_x() const;
-  void clear_vertical_dotted_line_x();
-  static const int kVerticalDottedLineXFieldNumber = 22;
-  double vertical_dotted_line_x() const;
-  void set_vertical_dotted_line_x(double value);
+  private:
+  bool _internal_dotted_line() const;
+  void _internal_set_dotted_line(bool value);
+  public:
 
   // optional .config.OutputType output_type = 23 [default = SVG];
   bool has_output_type() const;
+  private:
+  bool _internal_has_output_type() const;
+  public:
   void clear_output_type();
-  static const int kOutputTypeFieldNumber = 23;
   ::config::OutputType output_type() const;
   void set_output_type(::config::OutputType value);
+  private:
+  ::config::OutputType _internal_output_type() const;
+  void _internal_set_output_type(::config::OutputType value);
+  public:
 
-  // @@protoc_insertion_point(class_scope:config.CalendarConfig)
- private:
-  inline void set_has_num_years();
-  inline void clear_has_num_years();
-  inline void set_has_first_month();
-  inline void clear_has_first_month();
-  inline void set_has_num_months();
-  inline void clear_has_num_months();
-  inline void set_has_cell_size();
-  inline void clear_has_cell_size();
-  inline void set_has_cell_margin();
-  inline void clear_has_cell_margin();
-  inline void set_has_font_size();
-  inline void clear_has_font_size();
-  inline void set_has_bigger_font_size();
-  inline void clear_has_bigger_font_size();
-  inline void set_has_line_width();
-  inline void clear_has_line_width();
-  inline void set_has_month_label_height();
-  inline void clear_has_month_label_height();
-  inline void set_has_year_label_width();
-  inline void clear_has_year_label_width();
-  inline void set_has_rgb_header();
-  inline void clear_has_rgb_header();
-  inline void set_has_rgb_header_sunday();
-  inline void clear_has_rgb_header_sunday();
-  inline void set_has_rgb_month_line();
-  inline void clear_has_rgb_month_line();
-  inline void set_has_rgb_holiday();
-  inline void clear_has_rgb_holiday();
-  inline void set_has_bottom_left_label();
-  inline void clear_has_bottom_left_label();
-  inline void set_has_bottom_right_label();
-  inline void clear_has_bottom_right_label();
-  inline void set_has_header_font_family();
-  inline void clear_has_header_font_family();
-  inline void set_has_number_font_family();
-  inline void clear_has_number_font_family();
-  inline void set_has_quote_font_family();
-  inline void clear_has_quote_font_family();
-  inline void set_has_dotted_line();
-  inline void clear_has_dotted_line();
-  inline void set_has_vertical_dotted_line_x();
-  inline void clear_has_vertical_dotted_line_x();
-  inline void set_has_output_type();
-  inline void clear_has_output_type();
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::uint32 _has_bits_[1];
-  mutable int _cached_size_;
-  ::google::protobuf::int32 num_years_;
-  ::google::protobuf::int32 first_month_;
-  ::google::protobuf::RepeatedPtrField< ::config::SpecialDay > special_day_;
-  double cell_size_;
-  double cell_margin_;
-  double font_size_;
-  double bigger_font_size_;
-  double line_width_;
-  double month_label_height_;
-  double year_label_width_;
-  ::config::RGB* rgb_header_;
-  ::google::protobuf::int32 num_months_;
-  bool dotted_line_;
-  ::config::RGB* rgb_header_sunday_;
-  ::config::RGB* rgb_month_line_;
-  ::config::RGB* rgb_holiday_;
-  ::google::protobuf::internal::ArenaStringPtr bottom_left_label_;
-  ::google::protobuf::internal::ArenaStringPtr bottom_right_label_;
-  ::google::protobuf::internal::ArenaStringPtr header_font_family_;
-  ::google::protobuf::internal::ArenaStringPtr number_font_family_;
-  ::google::protobuf::internal::ArenaStringPtr quote_font_family_;
-  double vertical_dotted_line_x_;
-  int output_type_;
-  friend void  protobuf_AddDesc_config_2eproto();
-  friend void protobuf_AssignDesc_config_2eproto();
-  friend void protobuf_ShutdownFile_config_2eproto();
-
-  void InitAsDefaultInstance();
-  static CalendarConfig* default_instance_;
-};
-// -------------------------------------------------------------------
+  // optional int32 tile_height = 28;
+  bool has_tile_height() const;
+  private:
+  bool _internal_has_tile_height() const;
+  public:
+  void clear_tile_height();
+  int32_t tile_height() const;
+  void set_tile_height(int32_t value);
+  private:
+  int32_t _internal_tile_height() const;
+  void _internal_set_tile_height(int32_t value);
+  public:
 
-class SpecialDay : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:config.SpecialDay) */ {
+  // optional int32 start_year = 29;
+  bool has_start_year() const;
+  private:
+  bool _internal_has_start_year() const;
+  public:
+  void clear_start_year();
+  int32_t start_year() const;
+  void set_start_year(int32_t value);
+  private:
+  int32_t _internal_start_year() const;
+  void _internal_set_start_year(int32_t value);
+  public:
+
+  // optional bool share_svg_paths = 30 [default = true];
+  bool has_share_svg_paths() const;
+  private:
+  bool _internal_has_share_svg_paths() const;
+  public:
+  void clear_share_svg_paths();
+  bool share_svg_paths() const;
+  void set_share_svg_paths(bool value);
+  private:
+  bool _internal_share_svg_paths() const;
+  void _internal_set_share_svg_paths(bool value);
+  public:
+
+  // optional int32 num_years = 1 [default = 30];
+  bool has_num_years() const;
+  private:
+  bool _internal_has_num_years() const;
+  public:
+  void clear_num_years();
+  int32_t num_years() const;
+  void set_num_years(int32_t value);
+  private:
+  int32_t _internal_num_years() const;
+  void _internal_set_num_years(int32_t value);
+  public:
+
+  // optional int32 first_month = 2 [default = 1];
+  bool has_first_month() const;
+  private:
+  bool _internal_has_first_month() const;
+  public:
+  void clear_first_month();
+  int32_t first_month() const;
+  void set_first_month(int32_t value);
+  private:
+  int32_t _internal_first_month() const;
+  void _internal_set_first_month(int32_t value);
+  public:
+
+  // optional int32 num_months = 3 [default = 12];
+  bool has_num_months() const;
+  private:
+  bool _internal_has_num_months() const;
+  public:
+  void clear_num_months();
+  int32_t num_months() const;
+  void set_num_months(int32_t value);
+  private:
+  int32_t _internal_num_months() const;
+  void _internal_set_num_months(int32_t value);
+  public:
+
+  // optional int32 render_threads = 27 [default = 1];
+  bool has_render_threads() const;
+  private:
+  bool _internal_has_render_threads() const;
+  public:
+  void clear_render_threads();
+  int32_t render_threads() const;
+  void set_render_threads(int32_t value);
+  private:
+  int32_t _internal_render_threads() const;
+  void _internal_set_render_threads(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:config.CalendarConfig)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::config::SpecialDay > special_day_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::config::HolidayRule > holiday_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField<int> output_types_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr bottom_left_label_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr bottom_right_label_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr header_font_family_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr number_font_family_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr quote_font_family_;
+    static const ::PROTOBUF_NAMESPACE_ID::internal::LazyString _i_give_permission_to_break_this_code_default_output_name_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr output_name_;
+    ::config::RGB* rgb_header_;
+    ::config::RGB* rgb_header_sunday_;
+    ::config::RGB* rgb_month_line_;
+    ::config::RGB* rgb_holiday_;
+    double cell_size_;
+    double cell_margin_;
+    double font_size_;
+    double bigger_font_size_;
+    double line_width_;
+    double month_label_height_;
+    double year_label_width_;
+    double vertical_dotted_line_x_;
+    bool dotted_line_;
+    int output_type_;
+    int32_t tile_height_;
+    int32_t start_year_;
+    bool share_svg_paths_;
+    int32_t num_years_;
+    int32_t first_month_;
+    int32_t num_months_;
+    int32_t render_threads_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_config_2eproto;
+};
+// -------------------------------------------------------------------
+
+class SpecialDay final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:config.SpecialDay) */ {
  public:
-  SpecialDay();
-  virtual ~SpecialDay();
+  inline SpecialDay() : SpecialDay(nullptr) {}
+  ~SpecialDay() override;
+  explicit PROTOBUF_CONSTEXPR SpecialDay(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   SpecialDay(const SpecialDay& from);
+  SpecialDay(SpecialDay&& from) noexcept
+    : SpecialDay() {
+    *this = ::std::move(from);
+  }
 
   inline SpecialDay& operator=(const SpecialDay& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _internal_metadata_.unknown_fields();
+  inline SpecialDay& operator=(SpecialDay&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return _internal_metadata_.mutable_unknown_fields();
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const SpecialDay& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SpecialDay& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SpecialDay* internal_default_instance() {
+    return reinterpret_cast<const SpecialDay*>(
+               &_SpecialDay_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
 
-  void Swap(SpecialDay* other);
+  friend void swap(SpecialDay& a, SpecialDay& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SpecialDay* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SpecialDay* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline SpecialDay* New() const { return New(NULL); }
-
-  SpecialDay* New(::google::protobuf::Arena* arena) const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+  SpecialDay* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SpecialDay>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const SpecialDay& from);
-  void MergeFrom(const SpecialDay& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
-    return InternalSerializeWithCachedSizesToArray(false, output);
-  }
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SpecialDay& from) {
+    SpecialDay::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
   void InternalSwap(SpecialDay* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return _internal_metadata_.arena();
-  }
-  inline void* MaybeArenaPtr() const {
-    return _internal_metadata_.raw_arena_ptr();
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "config.SpecialDay";
   }
+  protected:
+  explicit SpecialDay(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kSvgFieldNumber = 3,
+    kRgbFieldNumber = 6,
+    kMonthFieldNumber = 1,
+    kDayFieldNumber = 2,
+    kFirstYearFieldNumber = 4,
+    kYearFieldNumber = 5,
+  };
+  // optional string svg = 3;
+  bool has_svg() const;
+  private:
+  bool _internal_has_svg() const;
+  public:
+  void clear_svg();
+  const std::string& svg() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_svg(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_svg();
+  PROTOBUF_NODISCARD std::string* release_svg();
+  void set_allocated_svg(std::string* svg);
+  private:
+  const std::string& _internal_svg() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_svg(const std::string& value);
+  std::string* _internal_mutable_svg();
+  public:
+
+  // optional .config.RGB rgb = 6;
+  bool has_rgb() const;
+  private:
+  bool _internal_has_rgb() const;
+  public:
+  void clear_rgb();
+  const ::config::RGB& rgb() const;
+  PROTOBUF_NODISCARD ::config::RGB* release_rgb();
+  ::config::RGB* mutable_rgb();
+  void set_allocated_rgb(::config::RGB* rgb);
+  private:
+  const ::config::RGB& _internal_rgb() const;
+  ::config::RGB* _internal_mutable_rgb();
+  public:
+  void unsafe_arena_set_allocated_rgb(
+      ::config::RGB* rgb);
+  ::config::RGB* unsafe_arena_release_rgb();
+
   // required int32 month = 1;
   bool has_month() const;
+  private:
+  bool _internal_has_month() const;
+  public:
   void clear_month();
-  static const int kMonthFieldNumber = 1;
-  ::google::protobuf::int32 month() const;
-  void set_month(::google::protobuf::int32 value);
+  int32_t month() const;
+  void set_month(int32_t value);
+  private:
+  int32_t _internal_month() const;
+  void _internal_set_month(int32_t value);
+  public:
 
   // required int32 day = 2;
   bool has_day() const;
+  private:
+  bool _internal_has_day() const;
+  public:
   void clear_day();
-  static const int kDayFieldNumber = 2;
-  ::google::protobuf::int32 day() const;
-  void set_day(::google::protobuf::int32 value);
-
-  // optional string svg = 3;
-  bool has_svg() const;
-  void clear_svg();
-  static const int kSvgFieldNumber = 3;
-  const ::std::string& svg() const;
-  void set_svg(const ::std::string& value);
-  void set_svg(const char* value);
-  void set_svg(const char* value, size_t size);
-  ::std::string* mutable_svg();
-  ::std::string* release_svg();
-  void set_allocated_svg(::std::string* svg);
+  int32_t day() const;
+  void set_day(int32_t value);
+  private:
+  int32_t _internal_day() const;
+  void _internal_set_day(int32_t value);
+  public:
 
   // optional int32 first_year = 4;
   bool has_first_year() const;
+  private:
+  bool _internal_has_first_year() const;
+  public:
   void clear_first_year();
-  static const int kFirstYearFieldNumber = 4;
-  ::google::protobuf::int32 first_year() const;
-  void set_first_year(::google::protobuf::int32 value);
+  int32_t first_year() const;
+  void set_first_year(int32_t value);
+  private:
+  int32_t _internal_first_year() const;
+  void _internal_set_first_year(int32_t value);
+  public:
 
   // optional int32 year = 5;
   bool has_year() const;
+  private:
+  bool _internal_has_year() const;
+  public:
   void clear_year();
-  static const int kYearFieldNumber = 5;
-  ::google::protobuf::int32 year() const;
-  void set_year(::google::protobuf::int32 value);
-
-  // optional .config.RGB rgb = 6;
-  bool has_rgb() const;
-  void clear_rgb();
-  static const int kRgbFieldNumber = 6;
-  const ::config::RGB& rgb() const;
-  ::config::RGB* mutable_rgb();
-  ::config::RGB* release_rgb();
-  void set_allocated_rgb(::config::RGB* rgb);
+  int32_t year() const;
+  void set_year(int32_t value);
+  private:
+  int32_t _internal_year() const;
+  void _internal_set_year(int32_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:config.SpecialDay)
  private:
-  inline void set_has_month();
-  inline void clear_has_month();
-  inline void set_has_day();
-  inline void clear_has_day();
-  inline void set_has_svg();
-  inline void clear_has_svg();
-  inline void set_has_first_year();
-  inline void clear_has_first_year();
-  inline void set_has_year();
-  inline void clear_has_year();
-  inline void set_has_rgb();
-  inline void clear_has_rgb();
-
-  // helper for ByteSize()
-  int RequiredFieldsByteSizeFallback() const;
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::uint32 _has_bits_[1];
-  mutable int _cached_size_;
-  ::google::protobuf::int32 month_;
-  ::google::protobuf::int32 day_;
-  ::google::protobuf::internal::ArenaStringPtr svg_;
-  ::google::protobuf::int32 first_year_;
-  ::google::protobuf::int32 year_;
-  ::config::RGB* rgb_;
-  friend void  protobuf_AddDesc_config_2eproto();
-  friend void protobuf_AssignDesc_config_2eproto();
-  friend void protobuf_ShutdownFile_config_2eproto();
-
-  void InitAsDefaultInstance();
-  static SpecialDay* default_instance_;
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr svg_;
+    ::config::RGB* rgb_;
+    int32_t month_;
+    int32_t day_;
+    int32_t first_year_;
+    int32_t year_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_config_2eproto;
 };
 // -------------------------------------------------------------------
 
-class RGB : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:config.RGB) */ {
+class RGB final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:config.RGB) */ {
  public:
-  RGB();
-  virtual ~RGB();
+  inline RGB() : RGB(nullptr) {}
+  ~RGB() override;
+  explicit PROTOBUF_CONSTEXPR RGB(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   RGB(const RGB& from);
+  RGB(RGB&& from) noexcept
+    : RGB() {
+    *this = ::std::move(from);
+  }
 
   inline RGB& operator=(const RGB& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _internal_metadata_.unknown_fields();
+  inline RGB& operator=(RGB&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return _internal_metadata_.mutable_unknown_fields();
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const RGB& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const RGB& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const RGB* internal_default_instance() {
+    return reinterpret_cast<const RGB*>(
+               &_RGB_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
 
-  void Swap(RGB* other);
+  friend void swap(RGB& a, RGB& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(RGB* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(RGB* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline RGB* New() const { return New(NULL); }
-
-  RGB* New(::google::protobuf::Arena* arena) const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+  RGB* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<RGB>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const RGB& from);
-  void MergeFrom(const RGB& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
-    return InternalSerializeWithCachedSizesToArray(false, output);
-  }
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const RGB& from) {
+    RGB::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
   void InternalSwap(RGB* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return _internal_metadata_.arena();
-  }
-  inline void* MaybeArenaPtr() const {
-    return _internal_metadata_.raw_arena_ptr();
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "config.RGB";
   }
+  protected:
+  explicit RGB(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kRedFieldNumber = 1,
+    kGreenFieldNumber = 2,
+    kBlueFieldNumber = 3,
+  };
   // required int32 red = 1;
   bool has_red() const;
+  private:
+  bool _internal_has_red() const;
+  public:
   void clear_red();
-  static const int kRedFieldNumber = 1;
-  ::google::protobuf::int32 red() const;
-  void set_red(::google::protobuf::int32 value);
+  int32_t red() const;
+  void set_red(int32_t value);
+  private:
+  int32_t _internal_red() const;
+  void _internal_set_red(int32_t value);
+  public:
 
   // required int32 green = 2;
   bool has_green() const;
+  private:
+  bool _internal_has_green() const;
+  public:
   void clear_green();
-  static const int kGreenFieldNumber = 2;
-  ::google::protobuf::int32 green() const;
-  void set_green(::google::protobuf::int32 value);
+  int32_t green() const;
+  void set_green(int32_t value);
+  private:
+  int32_t _internal_green() const;
+  void _internal_set_green(int32_t value);
+  public:
 
   // required int32 blue = 3;
   bool has_blue() const;
+  private:
+  bool _internal_has_blue() const;
+  public:
   void clear_blue();
-  static const int kBlueFieldNumber = 3;
-  ::google::protobuf::int32 blue() const;
-  void set_blue(::google::protobuf::int32 value);
+  int32_t blue() const;
+  void set_blue(int32_t value);
+  private:
+  int32_t _internal_blue() const;
+  void _internal_set_blue(int32_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:config.RGB)
  private:
-  inline void set_has_red();
-  inline void clear_has_red();
-  inline void set_has_green();
-  inline void clear_has_green();
-  inline void set_has_blue();
-  inline void clear_has_blue();
-
-  // helper for ByteSize()
-  int RequiredFieldsByteSizeFallback() const;
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::uint32 _has_bits_[1];
-  mutable int _cached_size_;
-  ::google::protobuf::int32 red_;
-  ::google::protobuf::int32 green_;
-  ::google::protobuf::int32 blue_;
-  friend void  protobuf_AddDesc_config_2eproto();
-  friend void protobuf_AssignDesc_config_2eproto();
-  friend void protobuf_ShutdownFile_config_2eproto();
-
-  void InitAsDefaultInstance();
-  static RGB* default_instance_;
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    int32_t red_;
+    int32_t green_;
+    int32_t blue_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_config_2eproto;
+};
+// -------------------------------------------------------------------
+
+class HolidayRule final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:config.HolidayRule) */ {
+ public:
+  inline HolidayRule() : HolidayRule(nullptr) {}
+  ~HolidayRule() override;
+  explicit PROTOBUF_CONSTEXPR HolidayRule(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  HolidayRule(const HolidayRule& from);
+  HolidayRule(HolidayRule&& from) noexcept
+    : HolidayRule() {
+    *this = ::std::move(from);
+  }
+
+  inline HolidayRule& operator=(const HolidayRule& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline HolidayRule& operator=(HolidayRule&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const HolidayRule& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const HolidayRule* internal_default_instance() {
+    return reinterpret_cast<const HolidayRule*>(
+               &_HolidayRule_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    3;
+
+  friend void swap(HolidayRule& a, HolidayRule& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(HolidayRule* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(HolidayRule* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  HolidayRule* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<HolidayRule>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const HolidayRule& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const HolidayRule& from) {
+    HolidayRule::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(HolidayRule* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "config.HolidayRule";
+  }
+  protected:
+  explicit HolidayRule(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kNameFieldNumber = 1,
+    kMonthFieldNumber = 2,
+    kDayFieldNumber = 3,
+    kWdayFieldNumber = 4,
+    kWeekFieldNumber = 5,
+    kSaturdayToFridayFieldNumber = 6,
+    kSundayToMondayFieldNumber = 7,
+  };
+  // optional string name = 1;
+  bool has_name() const;
+  private:
+  bool _internal_has_name() const;
+  public:
+  void clear_name();
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
+
+  // required int32 month = 2;
+  bool has_month() const;
+  private:
+  bool _internal_has_month() const;
+  public:
+  void clear_month();
+  int32_t month() const;
+  void set_month(int32_t value);
+  private:
+  int32_t _internal_month() const;
+  void _internal_set_month(int32_t value);
+  public:
+
+  // optional int32 day = 3;
+  bool has_day() const;
+  private:
+  bool _internal_has_day() const;
+  public:
+  void clear_day();
+  int32_t day() const;
+  void set_day(int32_t value);
+  private:
+  int32_t _internal_day() const;
+  void _internal_set_day(int32_t value);
+  public:
+
+  // optional int32 wday = 4;
+  bool has_wday() const;
+  private:
+  bool _internal_has_wday() const;
+  public:
+  void clear_wday();
+  int32_t wday() const;
+  void set_wday(int32_t value);
+  private:
+  int32_t _internal_wday() const;
+  void _internal_set_wday(int32_t value);
+  public:
+
+  // optional int32 week = 5;
+  bool has_week() const;
+  private:
+  bool _internal_has_week() const;
+  public:
+  void clear_week();
+  int32_t week() const;
+  void set_week(int32_t value);
+  private:
+  int32_t _internal_week() const;
+  void _internal_set_week(int32_t value);
+  public:
+
+  // optional bool saturday_to_friday = 6 [default = false];
+  bool has_saturday_to_friday() const;
+  private:
+  bool _internal_has_saturday_to_friday() const;
+  public:
+  void clear_saturday_to_friday();
+  bool saturday_to_friday() const;
+  void set_saturday_to_friday(bool value);
+  private:
+  bool _internal_saturday_to_friday() const;
+  void _internal_set_saturday_to_friday(bool value);
+  public:
+
+  // optional bool sunday_to_monday = 7 [default = false];
+  bool has_sunday_to_monday() const;
+  private:
+  bool _internal_has_sunday_to_monday() const;
+  public:
+  void clear_sunday_to_monday();
+  bool sunday_to_monday() const;
+  void set_sunday_to_monday(bool value);
+  private:
+  bool _internal_sunday_to_monday() const;
+  void _internal_set_sunday_to_monday(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:config.HolidayRule)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    int32_t month_;
+    int32_t day_;
+    int32_t wday_;
+    int32_t week_;
+    bool saturday_to_friday_;
+    bool sunday_to_monday_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_config_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CalendarBatch final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:config.CalendarBatch) */ {
+ public:
+  inline CalendarBatch() : CalendarBatch(nullptr) {}
+  ~CalendarBatch() override;
+  explicit PROTOBUF_CONSTEXPR CalendarBatch(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CalendarBatch(const CalendarBatch& from);
+  CalendarBatch(CalendarBatch&& from) noexcept
+    : CalendarBatch() {
+    *this = ::std::move(from);
+  }
+
+  inline CalendarBatch& operator=(const CalendarBatch& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CalendarBatch& operator=(CalendarBatch&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CalendarBatch& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CalendarBatch* internal_default_instance() {
+    return reinterpret_cast<const CalendarBatch*>(
+               &_CalendarBatch_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    4;
+
+  friend void swap(CalendarBatch& a, CalendarBatch& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CalendarBatch* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CalendarBatch* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CalendarBatch* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CalendarBatch>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CalendarBatch& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CalendarBatch& from) {
+    CalendarBatch::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CalendarBatch* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "config.CalendarBatch";
+  }
+  protected:
+  explicit CalendarBatch(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kConfigFileFieldNumber = 1,
+    kConfigFieldNumber = 2,
+    kJobsFieldNumber = 3,
+  };
+  // repeated string config_file = 1;
+  int config_file_size() const;
+  private:
+  int _internal_config_file_size() const;
+  public:
+  void clear_config_file();
+  const std::string& config_file(int index) const;
+  std::string* mutable_config_file(int index);
+  void set_config_file(int index, const std::string& value);
+  void set_config_file(int index, std::string&& value);
+  void set_config_file(int index, const char* value);
+  void set_config_file(int index, const char* value, size_t size);
+  std::string* add_config_file();
+  void add_config_file(const std::string& value);
+  void add_config_file(std::string&& value);
+  void add_config_file(const char* value);
+  void add_config_file(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& config_file() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_config_file();
+  private:
+  const std::string& _internal_config_file(int index) const;
+  std::string* _internal_add_config_file();
+  public:
+
+  // repeated .config.CalendarConfig config = 2;
+  int config_size() const;
+  private:
+  int _internal_config_size() const;
+  public:
+  void clear_config();
+  ::config::CalendarConfig* mutable_config(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::config::CalendarConfig >*
+      mutable_config();
+  private:
+  const ::config::CalendarConfig& _internal_config(int index) const;
+  ::config::CalendarConfig* _internal_add_config();
+  public:
+  const ::config::CalendarConfig& config(int index) const;
+  ::config::CalendarConfig* add_config();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::config::CalendarConfig >&
+      config() const;
+
+  // optional int32 jobs = 3 [default = 1];
+  bool has_jobs() const;
+  private:
+  bool _internal_has_jobs() const;
+  public:
+  void clear_jobs();
+  int32_t jobs() const;
+  void set_jobs(int32_t value);
+  private:
+  int32_t _internal_jobs() const;
+  void _internal_set_jobs(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:config.CalendarBatch)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> config_file_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::config::CalendarConfig > config_;
+    int32_t jobs_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_config_2eproto;
 };
 // ===================================================================
 
 
 // ===================================================================
 
-#if !PROTOBUF_INLINE_NOT_IN_HEADERS
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
 // CalendarConfig
 
 // optional int32 num_years = 1 [default = 30];
-inline bool CalendarConfig::has_num_years() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+inline bool CalendarConfig::_internal_has_num_years() const {
+  bool value = (_impl_._has_bits_[0] & 0x00800000u) != 0;
+  return value;
 }
-inline void CalendarConfig::set_has_num_years() {
-  _has_bits_[0] |= 0x00000001u;
-}
-inline void CalendarConfig::clear_has_num_years() {
-  _has_bits_[0] &= ~0x00000001u;
+inline bool CalendarConfig::has_num_years() const {
+  return _internal_has_num_years();
 }
 inline void CalendarConfig::clear_num_years() {
-  num_years_ = 30;
-  clear_has_num_years();
+  _impl_.num_years_ = 30;
+  _impl_._has_bits_[0] &= ~0x00800000u;
 }
-inline ::google::protobuf::int32 CalendarConfig::num_years() const {
+inline int32_t CalendarConfig::_internal_num_years() const {
+  return _impl_.num_years_;
+}
+inline int32_t CalendarConfig::num_years() const {
   // @@protoc_insertion_point(field_get:config.CalendarConfig.num_years)
-  return num_years_;
+  return _internal_num_years();
+}
+inline void CalendarConfig::_internal_set_num_years(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00800000u;
+  _impl_.num_years_ = value;
 }
-inline void CalendarConfig::set_num_years(::google::protobuf::int32 value) {
-  set_has_num_years();
-  num_years_ = value;
+inline void CalendarConfig::set_num_years(int32_t value) {
+  _internal_set_num_years(value);
   // @@protoc_insertion_point(field_set:config.CalendarConfig.num_years)
 }
 
 // optional int32 first_month = 2 [default = 1];
-inline bool CalendarConfig::has_first_month() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
-}
-inline void CalendarConfig::set_has_first_month() {
-  _has_bits_[0] |= 0x00000002u;
+inline bool CalendarConfig::_internal_has_first_month() const {
+  bool value = (_impl_._has_bits_[0] & 0x01000000u) != 0;
+  return value;
 }
-inline void CalendarConfig::clear_has_first_month() {
-  _has_bits_[0] &= ~0x00000002u;
+inline bool CalendarConfig::has_first_month() const {
+  return _internal_has_first_month();
 }
 inline void CalendarConfig::clear_first_month() {
-  first_month_ = 1;
-  clear_has_first_month();
+  _impl_.first_month_ = 1;
+  _impl_._has_bits_[0] &= ~0x01000000u;
+}
+inline int32_t CalendarConfig::_internal_first_month() const {
+  return _impl_.first_month_;
 }
-inline ::google::protobuf::int32 CalendarConfig::first_month() const {
+inline int32_t CalendarConfig::first_month() const {
   // @@protoc_insertion_point(field_get:config.CalendarConfig.first_month)
-  return first_month_;
+  return _internal_first_month();
 }
-inline void CalendarConfig::set_first_month(::google::protobuf::int32 value) {
-  set_has_first_month();
-  first_month_ = value;
+inline void CalendarConfig::_internal_set_first_month(int32_t value) {
+  _impl_._has_bits_[0] |= 0x01000000u;
+  _impl_.first_month_ = value;
+}
+inline void CalendarConfig::set_first_month(int32_t value) {
+  _internal_set_first_month(value);
   // @@protoc_insertion_point(field_set:config.CalendarConfig.first_month)
 }
 
 // optional int32 num_months = 3 [default = 12];
-inline bool CalendarConfig::has_num_months() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
+inline bool CalendarConfig::_internal_has_num_months() const {
+  bool value = (_impl_._has_bits_[0] & 0x02000000u) != 0;
+  return value;
 }
-inline void CalendarConfig::set_has_num_months() {
-  _has_bits_[0] |= 0x00000004u;
-}
-inline void CalendarConfig::clear_has_num_months() {
-  _has_bits_[0] &= ~0x00000004u;
+inline bool CalendarConfig::has_num_months() const {
+  return _internal_has_num_months();
 }
 inline void CalendarConfig::clear_num_months() {
-  num_months_ = 12;
-  clear_has_num_months();
+  _impl_.num_months_ = 12;
+  _impl_._has_bits_[0] &= ~0x02000000u;
 }
-inline ::google::protobuf::int32 CalendarConfig::num_months() const {
+inline int32_t CalendarConfig::_internal_num_months() const {
+  return _impl_.num_months_;
+}
+inline int32_t CalendarConfig::num_months() const {
   // @@protoc_insertion_point(field_get:config.CalendarConfig.num_months)
-  return num_months_;
+  return _internal_num_months();
+}
+inline void CalendarConfig::_internal_set_num_months(int32_t value) {
+  _impl_._has_bits_[0] |= 0x02000000u;
+  _impl_.num_months_ = value;
 }
-inline void CalendarConfig::set_num_months(::google::protobuf::int32 value) {
-  set_has_num_months();
-  num_months_ = value;
+inline void CalendarConfig::set_num_months(int32_t value) {
+  _internal_set_num_months(value);
   // @@protoc_insertion_point(field_set:config.CalendarConfig.num_months)
 }
 
 // repeated .config.SpecialDay special_day = 4;
+inline int CalendarConfig::_internal_special_day_size() const {
+  return _impl_.special_day_.size();
+}
 inline int CalendarConfig::special_day_size() const {
-  return special_day_.size();
+  return _internal_special_day_size();
 }
 inline void CalendarConfig::clear_special_day() {
-  special_day_.Clear();
+  _impl_.special_day_.Clear();
+}
+inline ::config::SpecialDay* CalendarConfig::mutable_special_day(int index) {
+  // @@protoc_insertion_point(field_mutable:config.CalendarConfig.special_day)
+  return _impl_.special_day_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::config::SpecialDay >*
+CalendarConfig::mutable_special_day() {
+  // @@protoc_insertion_point(field_mutable_list:config.CalendarConfig.special_day)
+  return &_impl_.special_day_;
+}
+inline const ::config::SpecialDay& CalendarConfig::_internal_special_day(int index) const {
+  return _impl_.special_day_.Get(index);
 }
 inline const ::config::SpecialDay& CalendarConfig::special_day(int index) const {
   // @@protoc_insertion_point(field_get:config.CalendarConfig.special_day)
-  return special_day_.Get(index);
+  return _internal_special_day(index);
 }
-inline ::config::SpecialDay* CalendarConfig::mutable_special_day(int index) {
-  // @@protoc_insertion_point(field_mutable:config.CalendarConfig.special_day)
-  return special_day_.Mutable(index);
+inline ::config::SpecialDay* CalendarConfig::_internal_add_special_day() {
+  return _impl_.special_day_.Add();
 }
 inline ::config::SpecialDay* CalendarConfig::add_special_day() {
+  ::config::SpecialDay* _add = _internal_add_special_day();
   // @@protoc_insertion_point(field_add:config.CalendarConfig.special_day)
-  return special_day_.Add();
+  return _add;
 }
-inline ::google::protobuf::RepeatedPtrField< ::config::SpecialDay >*
-CalendarConfig::mutable_special_day() {
-  // @@protoc_insertion_point(field_mutable_list:config.CalendarConfig.special_day)
-  return &special_day_;
-}
-inline const ::google::protobuf::RepeatedPtrField< ::config::SpecialDay >&
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::config::SpecialDay >&
 CalendarConfig::special_day() const {
   // @@protoc_insertion_point(field_list:config.CalendarConfig.special_day)
-  return special_day_;
+  return _impl_.special_day_;
 }
 
 // optional double cell_size = 5;
-inline bool CalendarConfig::has_cell_size() const {
-  return (_has_bits_[0] & 0x00000010u) != 0;
+inline bool CalendarConfig::_internal_has_cell_size() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000400u) != 0;
+  return value;
 }
-inline void CalendarConfig::set_has_cell_size() {
-  _has_bits_[0] |= 0x00000010u;
-}
-inline void CalendarConfig::clear_has_cell_size() {
-  _has_bits_[0] &= ~0x00000010u;
+inline bool CalendarConfig::has_cell_size() const {
+  return _internal_has_cell_size();
 }
 inline void CalendarConfig::clear_cell_size() {
-  cell_size_ = 0;
-  clear_has_cell_size();
+  _impl_.cell_size_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000400u;
+}
+inline double CalendarConfig::_internal_cell_size() const {
+  return _impl_.cell_size_;
 }
 inline double CalendarConfig::cell_size() const {
   // @@protoc_insertion_point(field_get:config.CalendarConfig.cell_size)
-  return cell_size_;
+  return _internal_cell_size();
+}
+inline void CalendarConfig::_internal_set_cell_size(double value) {
+  _impl_._has_bits_[0] |= 0x00000400u;
+  _impl_.cell_size_ = value;
 }
 inline void CalendarConfig::set_cell_size(double value) {
-  set_has_cell_size();
-  cell_size_ = value;
+  _internal_set_cell_size(value);
   // @@protoc_insertion_point(field_set:config.CalendarConfig.cell_size)
 }
 
 // optional double cell_margin = 6;
-inline bool CalendarConfig::has_cell_margin() const {
-  return (_has_bits_[0] & 0x00000020u) != 0;
-}
-inline void CalendarConfig::set_has_cell_margin() {
-  _has_bits_[0] |= 0x00000020u;
+inline bool CalendarConfig::_internal_has_cell_margin() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000800u) != 0;
+  return value;
 }
-inline void CalendarConfig::clear_has_cell_margin() {
-  _has_bits_[0] &= ~0x00000020u;
+inline bool CalendarConfig::has_cell_margin() const {
+  return _internal_has_cell_margin();
 }
 inline void CalendarConfig::clear_cell_margin() {
-  cell_margin_ = 0;
-  clear_has_cell_margin();
+  _impl_.cell_margin_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000800u;
+}
+inline double CalendarConfig::_internal_cell_margin() const {
+  return _impl_.cell_margin_;
 }
 inline double CalendarConfig::cell_margin() const {
   // @@protoc_insertion_point(field_get:config.CalendarConfig.cell_margin)
-  return cell_margin_;
+  return _internal_cell_margin();
+}
+inline void CalendarConfig::_internal_set_cell_margin(double value) {
+  _impl_._has_bits_[0] |= 0x00000800u;
+  _impl_.cell_margin_ = value;
 }
 inline void CalendarConfig::set_cell_margin(double value) {
-  set_has_cell_margin();
-  cell_margin_ = value;
+  _internal_set_cell_margin(value);
   // @@protoc_insertion_point(field_set:config.CalendarConfig.cell_margin)
 }
 
 // optional double font_size = 7;
-inline bool CalendarConfig::has_font_size() const {
-  return (_has_bits_[0] & 0x00000040u) != 0;
+inline bool CalendarConfig::_internal_has_font_size() const {
+  bool value = (_impl_._has_bits_[0] & 0x00001000u) != 0;
+  return value;
 }
-inline void CalendarConfig::set_has_font_size() {
-  _has_bits_[0] |= 0x00000040u;
-}
-inline void CalendarConfig::clear_has_font_size() {
-  _has_bits_[0] &= ~0x00000040u;
+inline bool CalendarConfig::has_font_size() const {
+  return _internal_has_font_size();
 }
 inline void CalendarConfig::clear_font_size() {
-  font_size_ = 0;
-  clear_has_font_size();
+  _impl_.font_size_ = 0;
+  _impl_._has_bits_[0] &= ~0x00001000u;
+}
+inline double CalendarConfig::_internal_font_size() const {
+  return _impl_.font_size_;
 }
 inline double CalendarConfig::font_size() const {
   // @@protoc_insertion_point(field_get:config.CalendarConfig.font_size)
-  return font_size_;
+  return _internal_font_size();
+}
+inline void CalendarConfig::_internal_set_font_size(double value) {
+  _impl_._has_bits_[0] |= 0x00001000u;
+  _impl_.font_size_ = value;
 }
 inline void CalendarConfig::set_font_size(double value) {
-  set_has_font_size();
-  font_size_ = value;
+  _internal_set_font_size(value);
   // @@protoc_insertion_point(field_set:config.CalendarConfig.font_size)
 }
 
 // optional double bigger_font_size = 8;
-inline bool CalendarConfig::has_bigger_font_size() const {
-  return (_has_bits_[0] & 0x00000080u) != 0;
-}
-inline void CalendarConfig::set_has_bigger_font_size() {
-  _has_bits_[0] |= 0x00000080u;
+inline bool CalendarConfig::_internal_has_bigger_font_size() const {
+  bool value = (_impl_._has_bits_[0] & 0x00002000u) != 0;
+  return value;
 }
-inline void CalendarConfig::clear_has_bigger_font_size() {
-  _has_bits_[0] &= ~0x00000080u;
+inline bool CalendarConfig::has_bigger_font_size() const {
+  return _internal_has_bigger_font_size();
 }
 inline void CalendarConfig::clear_bigger_font_size() {
-  bigger_font_size_ = 0;
-  clear_has_bigger_font_size();
+  _impl_.bigger_font_size_ = 0;
+  _impl_._has_bits_[0] &= ~0x00002000u;
+}
+inline double CalendarConfig::_internal_bigger_font_size() const {
+  return _impl_.bigger_font_size_;
 }
 inline double CalendarConfig::bigger_font_size() const {
   // @@protoc_insertion_point(field_get:config.CalendarConfig.bigger_font_size)
-  return bigger_font_size_;
+  return _internal_bigger_font_size();
+}
+inline void CalendarConfig::_internal_set_bigger_font_size(double value) {
+  _impl_._has_bits_[0] |= 0x00002000u;
+  _impl_.bigger_font_size_ = value;
 }
 inline void CalendarConfig::set_bigger_font_size(double value) {
-  set_has_bigger_font_size();
-  bigger_font_size_ = value;
+  _internal_set_bigger_font_size(value);
   // @@protoc_insertion_point(field_set:config.CalendarConfig.bigger_font_size)
 }
 
 // optional double line_width = 9;
-inline bool CalendarConfig::has_line_width() const {
-  return (_has_bits_[0] & 0x00000100u) != 0;
+inline bool CalendarConfig::_internal_has_line_width() const {
+  bool value = (_impl_._has_bits_[0] & 0x00004000u) != 0;
+  return value;
 }
-inline void CalendarConfig::set_has_line_width() {
-  _has_bits_[0] |= 0x00000100u;
-}
-inline void CalendarConfig::clear_has_line_width() {
-  _has_bits_[0] &= ~0x00000100u;
+inline bool CalendarConfig::has_line_width() const {
+  return _internal_has_line_width();
 }
 inline void CalendarConfig::clear_line_width() {
-  line_width_ = 0;
-  clear_has_line_width();
+  _impl_.line_width_ = 0;
+  _impl_._has_bits_[0] &= ~0x00004000u;
+}
+inline double CalendarConfig::_internal_line_width() const {
+  return _impl_.line_width_;
 }
 inline double CalendarConfig::line_width() const {
   // @@protoc_insertion_point(field_get:config.CalendarConfig.line_width)
-  return line_width_;
+  return _internal_line_width();
+}
+inline void CalendarConfig::_internal_set_line_width(double value) {
+  _impl_._has_bits_[0] |= 0x00004000u;
+  _impl_.line_width_ = value;
 }
 inline void CalendarConfig::set_line_width(double value) {
-  set_has_line_width();
-  line_width_ = value;
+  _internal_set_line_width(value);
   // @@protoc_insertion_point(field_set:config.CalendarConfig.line_width)
 }
 
 // optional double month_label_height = 10;
-inline bool CalendarConfig::has_month_label_height() const {
-  return (_has_bits_[0] & 0x00000200u) != 0;
-}
-inline void CalendarConfig::set_has_month_label_height() {
-  _has_bits_[0] |= 0x00000200u;
+inline bool CalendarConfig::_internal_has_month_label_height() const {
+  bool value = (_impl_._has_bits_[0] & 0x00008000u) != 0;
+  return value;
 }
-inline void CalendarConfig::clear_has_month_label_height() {
-  _has_bits_[0] &= ~0x00000200u;
+inline bool CalendarConfig::has_month_label_height() const {
+  return _internal_has_month_label_height();
 }
 inline void CalendarConfig::clear_month_label_height() {
-  month_label_height_ = 0;
-  clear_has_month_label_height();
+  _impl_.month_label_height_ = 0;
+  _impl_._has_bits_[0] &= ~0x00008000u;
+}
+inline double CalendarConfig::_internal_month_label_height() const {
+  return _impl_.month_label_height_;
 }
 inline double CalendarConfig::month_label_height() const {
   // @@protoc_insertion_point(field_get:config.CalendarConfig.month_label_height)
-  return month_label_height_;
+  return _internal_month_label_height();
+}
+inline void CalendarConfig::_internal_set_month_label_height(double value) {
+  _impl_._has_bits_[0] |= 0x00008000u;
+  _impl_.month_label_height_ = value;
 }
 inline void CalendarConfig::set_month_label_height(double value) {
-  set_has_month_label_height();
-  month_label_height_ = value;
+  _internal_set_month_label_height(value);
   // @@protoc_insertion_point(field_set:config.CalendarConfig.month_label_height)
 }
 
 // optional double year_label_width = 11;
-inline bool CalendarConfig::has_year_label_width() const {
-  return (_has_bits_[0] & 0x00000400u) != 0;
+inline bool CalendarConfig::_internal_has_year_label_width() const {
+  bool value = (_impl_._has_bits_[0] & 0x00010000u) != 0;
+  return value;
 }
-inline void CalendarConfig::set_has_year_label_width() {
-  _has_bits_[0] |= 0x00000400u;
-}
-inline void CalendarConfig::clear_has_year_label_width() {
-  _has_bits_[0] &= ~0x00000400u;
+inline bool CalendarConfig::has_year_label_width() const {
+  return _internal_has_year_label_width();
 }
 inline void CalendarConfig::clear_year_label_width() {
-  year_label_width_ = 0;
-  clear_has_year_label_width();
+  _impl_.year_label_width_ = 0;
+  _impl_._has_bits_[0] &= ~0x00010000u;
+}
+inline double CalendarConfig::_internal_year_label_width() const {
+  return _impl_.year_label_width_;
 }
 inline double CalendarConfig::year_label_width() const {
   // @@protoc_insertion_point(field_get:config.CalendarConfig.year_label_width)
-  return year_label_width_;
+  return _internal_year_label_width();
+}
+inline void CalendarConfig::_internal_set_year_label_width(double value) {
+  _impl_._has_bits_[0] |= 0x00010000u;
+  _impl_.year_label_width_ = value;
 }
 inline void CalendarConfig::set_year_label_width(double value) {
-  set_has_year_label_width();
-  year_label_width_ = value;
+  _internal_set_year_label_width(value);
   // @@protoc_insertion_point(field_set:config.CalendarConfig.year_label_width)
 }
 
 // optional .config.RGB rgb_header = 12;
-inline bool CalendarConfig::has_rgb_header() const {
-  return (_has_bits_[0] & 0x00000800u) != 0;
-}
-inline void CalendarConfig::set_has_rgb_header() {
-  _has_bits_[0] |= 0x00000800u;
+inline bool CalendarConfig::_internal_has_rgb_header() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.rgb_header_ != nullptr);
+  return value;
 }
-inline void CalendarConfig::clear_has_rgb_header() {
-  _has_bits_[0] &= ~0x00000800u;
+inline bool CalendarConfig::has_rgb_header() const {
+  return _internal_has_rgb_header();
 }
 inline void CalendarConfig::clear_rgb_header() {
-  if (rgb_header_ != NULL) rgb_header_->::config::RGB::Clear();
-  clear_has_rgb_header();
+  if (_impl_.rgb_header_ != nullptr) _impl_.rgb_header_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000040u;
+}
+inline const ::config::RGB& CalendarConfig::_internal_rgb_header() const {
+  const ::config::RGB* p = _impl_.rgb_header_;
+  return p != nullptr ? *p : reinterpret_cast<const ::config::RGB&>(
+      ::config::_RGB_default_instance_);
 }
 inline const ::config::RGB& CalendarConfig::rgb_header() const {
   // @@protoc_insertion_point(field_get:config.CalendarConfig.rgb_header)
-  return rgb_header_ != NULL ? *rgb_header_ : *default_instance_->rgb_header_;
+  return _internal_rgb_header();
 }
-inline ::config::RGB* CalendarConfig::mutable_rgb_header() {
-  set_has_rgb_header();
-  if (rgb_header_ == NULL) {
-    rgb_header_ = new ::config::RGB;
+inline void CalendarConfig::unsafe_arena_set_allocated_rgb_header(
+    ::config::RGB* rgb_header) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.rgb_header_);
   }
-  // @@protoc_insertion_point(field_mutable:config.CalendarConfig.rgb_header)
-  return rgb_header_;
+  _impl_.rgb_header_ = rgb_header;
+  if (rgb_header) {
+    _impl_._has_bits_[0] |= 0x00000040u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000040u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:config.CalendarConfig.rgb_header)
 }
 inline ::config::RGB* CalendarConfig::release_rgb_header() {
+  _impl_._has_bits_[0] &= ~0x00000040u;
+  ::config::RGB* temp = _impl_.rgb_header_;
+  _impl_.rgb_header_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::config::RGB* CalendarConfig::unsafe_arena_release_rgb_header() {
   // @@protoc_insertion_point(field_release:config.CalendarConfig.rgb_header)
-  clear_has_rgb_header();
-  ::config::RGB* temp = rgb_header_;
-  rgb_header_ = NULL;
+  _impl_._has_bits_[0] &= ~0x00000040u;
+  ::config::RGB* temp = _impl_.rgb_header_;
+  _impl_.rgb_header_ = nullptr;
   return temp;
 }
+inline ::config::RGB* CalendarConfig::_internal_mutable_rgb_header() {
+  _impl_._has_bits_[0] |= 0x00000040u;
+  if (_impl_.rgb_header_ == nullptr) {
+    auto* p = CreateMaybeMessage<::config::RGB>(GetArenaForAllocation());
+    _impl_.rgb_header_ = p;
+  }
+  return _impl_.rgb_header_;
+}
+inline ::config::RGB* CalendarConfig::mutable_rgb_header() {
+  ::config::RGB* _msg = _internal_mutable_rgb_header();
+  // @@protoc_insertion_point(field_mutable:config.CalendarConfig.rgb_header)
+  return _msg;
+}
 inline void CalendarConfig::set_allocated_rgb_header(::config::RGB* rgb_header) {
-  delete rgb_header_;
-  rgb_header_ = rgb_header;
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.rgb_header_;
+  }
   if (rgb_header) {
-    set_has_rgb_header();
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(rgb_header);
+    if (message_arena != submessage_arena) {
+      rgb_header = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, rgb_header, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000040u;
   } else {
-    clear_has_rgb_header();
+    _impl_._has_bits_[0] &= ~0x00000040u;
   }
+  _impl_.rgb_header_ = rgb_header;
   // @@protoc_insertion_point(field_set_allocated:config.CalendarConfig.rgb_header)
 }
 
 // optional .config.RGB rgb_header_sunday = 13;
-inline bool CalendarConfig::has_rgb_header_sunday() const {
-  return (_has_bits_[0] & 0x00001000u) != 0;
-}
-inline void CalendarConfig::set_has_rgb_header_sunday() {
-  _has_bits_[0] |= 0x00001000u;
+inline bool CalendarConfig::_internal_has_rgb_header_sunday() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000080u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.rgb_header_sunday_ != nullptr);
+  return value;
 }
-inline void CalendarConfig::clear_has_rgb_header_sunday() {
-  _has_bits_[0] &= ~0x00001000u;
+inline bool CalendarConfig::has_rgb_header_sunday() const {
+  return _internal_has_rgb_header_sunday();
 }
 inline void CalendarConfig::clear_rgb_header_sunday() {
-  if (rgb_header_sunday_ != NULL) rgb_header_sunday_->::config::RGB::Clear();
-  clear_has_rgb_header_sunday();
+  if (_impl_.rgb_header_sunday_ != nullptr) _impl_.rgb_header_sunday_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000080u;
+}
+inline const ::config::RGB& CalendarConfig::_internal_rgb_header_sunday() const {
+  const ::config::RGB* p = _impl_.rgb_header_sunday_;
+  return p != nullptr ? *p : reinterpret_cast<const ::config::RGB&>(
+      ::config::_RGB_default_instance_);
 }
 inline const ::config::RGB& CalendarConfig::rgb_header_sunday() const {
   // @@protoc_insertion_point(field_get:config.CalendarConfig.rgb_header_sunday)
-  return rgb_header_sunday_ != NULL ? *rgb_header_sunday_ : *default_instance_->rgb_header_sunday_;
+  return _internal_rgb_header_sunday();
 }
-inline ::config::RGB* CalendarConfig::mutable_rgb_header_sunday() {
-  set_has_rgb_header_sunday();
-  if (rgb_header_sunday_ == NULL) {
-    rgb_header_sunday_ = new ::config::RGB;
+inline void CalendarConfig::unsafe_arena_set_allocated_rgb_header_sunday(
+    ::config::RGB* rgb_header_sunday) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.rgb_header_sunday_);
   }
-  // @@protoc_insertion_point(field_mutable:config.CalendarConfig.rgb_header_sunday)
-  return rgb_header_sunday_;
+  _impl_.rgb_header_sunday_ = rgb_header_sunday;
+  if (rgb_header_sunday) {
+    _impl_._has_bits_[0] |= 0x00000080u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000080u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:config.CalendarConfig.rgb_header_sunday)
 }
 inline ::config::RGB* CalendarConfig::release_rgb_header_sunday() {
+  _impl_._has_bits_[0] &= ~0x00000080u;
+  ::config::RGB* temp = _impl_.rgb_header_sunday_;
+  _impl_.rgb_header_sunday_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::config::RGB* CalendarConfig::unsafe_arena_release_rgb_header_sunday() {
   // @@protoc_insertion_point(field_release:config.CalendarConfig.rgb_header_sunday)
-  clear_has_rgb_header_sunday();
-  ::config::RGB* temp = rgb_header_sunday_;
-  rgb_header_sunday_ = NULL;
+  _impl_._has_bits_[0] &= ~0x00000080u;
+  ::config::RGB* temp = _impl_.rgb_header_sunday_;
+  _impl_.rgb_header_sunday_ = nullptr;
   return temp;
 }
+inline ::config::RGB* CalendarConfig::_internal_mutable_rgb_header_sunday() {
+  _impl_._has_bits_[0] |= 0x00000080u;
+  if (_impl_.rgb_header_sunday_ == nullptr) {
+    auto* p = CreateMaybeMessage<::config::RGB>(GetArenaForAllocation());
+    _impl_.rgb_header_sunday_ = p;
+  }
+  return _impl_.rgb_header_sunday_;
+}
+inline ::config::RGB* CalendarConfig::mutable_rgb_header_sunday() {
+  ::config::RGB* _msg = _internal_mutable_rgb_header_sunday();
+  // @@protoc_insertion_point(field_mutable:config.CalendarConfig.rgb_header_sunday)
+  return _msg;
+}
 inline void CalendarConfig::set_allocated_rgb_header_sunday(::config::RGB* rgb_header_sunday) {
-  delete rgb_header_sunday_;
-  rgb_header_sunday_ = rgb_header_sunday;
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.rgb_header_sunday_;
+  }
   if (rgb_header_sunday) {
-    set_has_rgb_header_sunday();
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(rgb_header_sunday);
+    if (message_arena != submessage_arena) {
+      rgb_header_sunday = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, rgb_header_sunday, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000080u;
   } else {
-    clear_has_rgb_header_sunday();
+    _impl_._has_bits_[0] &= ~0x00000080u;
   }
+  _impl_.rgb_header_sunday_ = rgb_header_sunday;
   // @@protoc_insertion_point(field_set_allocated:config.CalendarConfig.rgb_header_sunday)
 }
 
 // optional .config.RGB rgb_month_line = 14;
-inline bool CalendarConfig::has_rgb_month_line() const {
-  return (_has_bits_[0] & 0x00002000u) != 0;
-}
-inline void CalendarConfig::set_has_rgb_month_line() {
-  _has_bits_[0] |= 0x00002000u;
+inline bool CalendarConfig::_internal_has_rgb_month_line() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000100u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.rgb_month_line_ != nullptr);
+  return value;
 }
-inline void CalendarConfig::clear_has_rgb_month_line() {
-  _has_bits_[0] &= ~0x00002000u;
+inline bool CalendarConfig::has_rgb_month_line() const {
+  return _internal_has_rgb_month_line();
 }
 inline void CalendarConfig::clear_rgb_month_line() {
-  if (rgb_month_line_ != NULL) rgb_month_line_->::config::RGB::Clear();
-  clear_has_rgb_month_line();
+  if (_impl_.rgb_month_line_ != nullptr) _impl_.rgb_month_line_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000100u;
+}
+inline const ::config::RGB& CalendarConfig::_internal_rgb_month_line() const {
+  const ::config::RGB* p = _impl_.rgb_month_line_;
+  return p != nullptr ? *p : reinterpret_cast<const ::config::RGB&>(
+      ::config::_RGB_default_instance_);
 }
 inline const ::config::RGB& CalendarConfig::rgb_month_line() const {
   // @@protoc_insertion_point(field_get:config.CalendarConfig.rgb_month_line)
-  return rgb_month_line_ != NULL ? *rgb_month_line_ : *default_instance_->rgb_month_line_;
+  return _internal_rgb_month_line();
 }
-inline ::config::RGB* CalendarConfig::mutable_rgb_month_line() {
-  set_has_rgb_month_line();
-  if (rgb_month_line_ == NULL) {
-    rgb_month_line_ = new ::config::RGB;
+inline void CalendarConfig::unsafe_arena_set_allocated_rgb_month_line(
+    ::config::RGB* rgb_month_line) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.rgb_month_line_);
   }
-  // @@protoc_insertion_point(field_mutable:config.CalendarConfig.rgb_month_line)
-  return rgb_month_line_;
+  _impl_.rgb_month_line_ = rgb_month_line;
+  if (rgb_month_line) {
+    _impl_._has_bits_[0] |= 0x00000100u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000100u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:config.CalendarConfig.rgb_month_line)
 }
 inline ::config::RGB* CalendarConfig::release_rgb_month_line() {
+  _impl_._has_bits_[0] &= ~0x00000100u;
+  ::config::RGB* temp = _impl_.rgb_month_line_;
+  _impl_.rgb_month_line_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::config::RGB* CalendarConfig::unsafe_arena_release_rgb_month_line() {
   // @@protoc_insertion_point(field_release:config.CalendarConfig.rgb_month_line)
-  clear_has_rgb_month_line();
-  ::config::RGB* temp = rgb_month_line_;
-  rgb_month_line_ = NULL;
+  _impl_._has_bits_[0] &= ~0x00000100u;
+  ::config::RGB* temp = _impl_.rgb_month_line_;
+  _impl_.rgb_month_line_ = nullptr;
   return temp;
 }
+inline ::config::RGB* CalendarConfig::_internal_mutable_rgb_month_line() {
+  _impl_._has_bits_[0] |= 0x00000100u;
+  if (_impl_.rgb_month_line_ == nullptr) {
+    auto* p = CreateMaybeMessage<::config::RGB>(GetArenaForAllocation());
+    _impl_.rgb_month_line_ = p;
+  }
+  return _impl_.rgb_month_line_;
+}
+inline ::config::RGB* CalendarConfig::mutable_rgb_month_line() {
+  ::config::RGB* _msg = _internal_mutable_rgb_month_line();
+  // @@protoc_insertion_point(field_mutable:config.CalendarConfig.rgb_month_line)
+  return _msg;
+}
 inline void CalendarConfig::set_allocated_rgb_month_line(::config::RGB* rgb_month_line) {
-  delete rgb_month_line_;
-  rgb_month_line_ = rgb_month_line;
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.rgb_month_line_;
+  }
   if (rgb_month_line) {
-    set_has_rgb_month_line();
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(rgb_month_line);
+    if (message_arena != submessage_arena) {
+      rgb_month_line = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, rgb_month_line, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000100u;
   } else {
-    clear_has_rgb_month_line();
+    _impl_._has_bits_[0] &= ~0x00000100u;
   }
+  _impl_.rgb_month_line_ = rgb_month_line;
   // @@protoc_insertion_point(field_set_allocated:config.CalendarConfig.rgb_month_line)
 }
 
 // optional .config.RGB rgb_holiday = 15;
-inline bool CalendarConfig::has_rgb_holiday() const {
-  return (_has_bits_[0] & 0x00004000u) != 0;
-}
-inline void CalendarConfig::set_has_rgb_holiday() {
-  _has_bits_[0] |= 0x00004000u;
+inline bool CalendarConfig::_internal_has_rgb_holiday() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000200u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.rgb_holiday_ != nullptr);
+  return value;
 }
-inline void CalendarConfig::clear_has_rgb_holiday() {
-  _has_bits_[0] &= ~0x00004000u;
+inline bool CalendarConfig::has_rgb_holiday() const {
+  return _internal_has_rgb_holiday();
 }
 inline void CalendarConfig::clear_rgb_holiday() {
-  if (rgb_holiday_ != NULL) rgb_holiday_->::config::RGB::Clear();
-  clear_has_rgb_holiday();
+  if (_impl_.rgb_holiday_ != nullptr) _impl_.rgb_holiday_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000200u;
+}
+inline const ::config::RGB& CalendarConfig::_internal_rgb_holiday() const {
+  const ::config::RGB* p = _impl_.rgb_holiday_;
+  return p != nullptr ? *p : reinterpret_cast<const ::config::RGB&>(
+      ::config::_RGB_default_instance_);
 }
 inline const ::config::RGB& CalendarConfig::rgb_holiday() const {
   // @@protoc_insertion_point(field_get:config.CalendarConfig.rgb_holiday)
-  return rgb_holiday_ != NULL ? *rgb_holiday_ : *default_instance_->rgb_holiday_;
+  return _internal_rgb_holiday();
 }
-inline ::config::RGB* CalendarConfig::mutable_rgb_holiday() {
-  set_has_rgb_holiday();
-  if (rgb_holiday_ == NULL) {
-    rgb_holiday_ = new ::config::RGB;
+inline void CalendarConfig::unsafe_arena_set_allocated_rgb_holiday(
+    ::config::RGB* rgb_holiday) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.rgb_holiday_);
   }
-  // @@protoc_insertion_point(field_mutable:config.CalendarConfig.rgb_holiday)
-  return rgb_holiday_;
+  _impl_.rgb_holiday_ = rgb_holiday;
+  if (rgb_holiday) {
+    _impl_._has_bits_[0] |= 0x00000200u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000200u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:config.CalendarConfig.rgb_holiday)
 }
 inline ::config::RGB* CalendarConfig::release_rgb_holiday() {
+  _impl_._has_bits_[0] &= ~0x00000200u;
+  ::config::RGB* temp = _impl_.rgb_holiday_;
+  _impl_.rgb_holiday_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::config::RGB* CalendarConfig::unsafe_arena_release_rgb_holiday() {
   // @@protoc_insertion_point(field_release:config.CalendarConfig.rgb_holiday)
-  clear_has_rgb_holiday();
-  ::config::RGB* temp = rgb_holiday_;
-  rgb_holiday_ = NULL;
+  _impl_._has_bits_[0] &= ~0x00000200u;
+  ::config::RGB* temp = _impl_.rgb_holiday_;
+  _impl_.rgb_holiday_ = nullptr;
   return temp;
 }
+inline ::config::RGB* CalendarConfig::_internal_mutable_rgb_holiday() {
+  _impl_._has_bits_[0] |= 0x00000200u;
+  if (_impl_.rgb_holiday_ == nullptr) {
+    auto* p = CreateMaybeMessage<::config::RGB>(GetArenaForAllocation());
+    _impl_.rgb_holiday_ = p;
+  }
+  return _impl_.rgb_holiday_;
+}
+inline ::config::RGB* CalendarConfig::mutable_rgb_holiday() {
+  ::config::RGB* _msg = _internal_mutable_rgb_holiday();
+  // @@protoc_insertion_point(field_mutable:config.CalendarConfig.rgb_holiday)
+  return _msg;
+}
 inline void CalendarConfig::set_allocated_rgb_holiday(::config::RGB* rgb_holiday) {
-  delete rgb_holiday_;
-  rgb_holiday_ = rgb_holiday;
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.rgb_holiday_;
+  }
   if (rgb_holiday) {
-    set_has_rgb_holiday();
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(rgb_holiday);
+    if (message_arena != submessage_arena) {
+      rgb_holiday = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, rgb_holiday, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000200u;
   } else {
-    clear_has_rgb_holiday();
+    _impl_._has_bits_[0] &= ~0x00000200u;
   }
+  _impl_.rgb_holiday_ = rgb_holiday;
   // @@protoc_insertion_point(field_set_allocated:config.CalendarConfig.rgb_holiday)
 }
 
 // optional string bottom_left_label = 16;
-inline bool CalendarConfig::has_bottom_left_label() const {
-  return (_has_bits_[0] & 0x00008000u) != 0;
-}
-inline void CalendarConfig::set_has_bottom_left_label() {
-  _has_bits_[0] |= 0x00008000u;
+inline bool CalendarConfig::_internal_has_bottom_left_label() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
 }
-inline void CalendarConfig::clear_has_bottom_left_label() {
-  _has_bits_[0] &= ~0x00008000u;
+inline bool CalendarConfig::has_bottom_left_label() const {
+  return _internal_has_bottom_left_label();
 }
 inline void CalendarConfig::clear_bottom_left_label() {
-  bottom_left_label_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  clear_has_bottom_left_label();
+  _impl_.bottom_left_label_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
 }
-inline const ::std::string& CalendarConfig::bottom_left_label() const {
+inline const std::string& CalendarConfig::bottom_left_label() const {
   // @@protoc_insertion_point(field_get:config.CalendarConfig.bottom_left_label)
-  return bottom_left_label_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _internal_bottom_left_label();
 }
-inline void CalendarConfig::set_bottom_left_label(const ::std::string& value) {
-  set_has_bottom_left_label();
-  bottom_left_label_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CalendarConfig::set_bottom_left_label(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.bottom_left_label_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:config.CalendarConfig.bottom_left_label)
 }
-inline void CalendarConfig::set_bottom_left_label(const char* value) {
-  set_has_bottom_left_label();
-  bottom_left_label_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:config.CalendarConfig.bottom_left_label)
+inline std::string* CalendarConfig::mutable_bottom_left_label() {
+  std::string* _s = _internal_mutable_bottom_left_label();
+  // @@protoc_insertion_point(field_mutable:config.CalendarConfig.bottom_left_label)
+  return _s;
+}
+inline const std::string& CalendarConfig::_internal_bottom_left_label() const {
+  return _impl_.bottom_left_label_.Get();
 }
-inline void CalendarConfig::set_bottom_left_label(const char* value, size_t size) {
-  set_has_bottom_left_label();
-  bottom_left_label_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:config.CalendarConfig.bottom_left_label)
+inline void CalendarConfig::_internal_set_bottom_left_label(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.bottom_left_label_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* CalendarConfig::mutable_bottom_left_label() {
-  set_has_bottom_left_label();
-  // @@protoc_insertion_point(field_mutable:config.CalendarConfig.bottom_left_label)
-  return bottom_left_label_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline std::string* CalendarConfig::_internal_mutable_bottom_left_label() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.bottom_left_label_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* CalendarConfig::release_bottom_left_label() {
+inline std::string* CalendarConfig::release_bottom_left_label() {
   // @@protoc_insertion_point(field_release:config.CalendarConfig.bottom_left_label)
-  clear_has_bottom_left_label();
-  return bottom_left_label_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  if (!_internal_has_bottom_left_label()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.bottom_left_label_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.bottom_left_label_.IsDefault()) {
+    _impl_.bottom_left_label_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
 }
-inline void CalendarConfig::set_allocated_bottom_left_label(::std::string* bottom_left_label) {
-  if (bottom_left_label != NULL) {
-    set_has_bottom_left_label();
+inline void CalendarConfig::set_allocated_bottom_left_label(std::string* bottom_left_label) {
+  if (bottom_left_label != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
   } else {
-    clear_has_bottom_left_label();
+    _impl_._has_bits_[0] &= ~0x00000001u;
   }
-  bottom_left_label_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), bottom_left_label);
+  _impl_.bottom_left_label_.SetAllocated(bottom_left_label, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.bottom_left_label_.IsDefault()) {
+    _impl_.bottom_left_label_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:config.CalendarConfig.bottom_left_label)
 }
 
 // optional string bottom_right_label = 17;
-inline bool CalendarConfig::has_bottom_right_label() const {
-  return (_has_bits_[0] & 0x00010000u) != 0;
+inline bool CalendarConfig::_internal_has_bottom_right_label() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
 }
-inline void CalendarConfig::set_has_bottom_right_label() {
-  _has_bits_[0] |= 0x00010000u;
-}
-inline void CalendarConfig::clear_has_bottom_right_label() {
-  _has_bits_[0] &= ~0x00010000u;
+inline bool CalendarConfig::has_bottom_right_label() const {
+  return _internal_has_bottom_right_label();
 }
 inline void CalendarConfig::clear_bottom_right_label() {
-  bottom_right_label_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  clear_has_bottom_right_label();
+  _impl_.bottom_right_label_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
 }
-inline const ::std::string& CalendarConfig::bottom_right_label() const {
+inline const std::string& CalendarConfig::bottom_right_label() const {
   // @@protoc_insertion_point(field_get:config.CalendarConfig.bottom_right_label)
-  return bottom_right_label_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _internal_bottom_right_label();
 }
-inline void CalendarConfig::set_bottom_right_label(const ::std::string& value) {
-  set_has_bottom_right_label();
-  bottom_right_label_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CalendarConfig::set_bottom_right_label(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.bottom_right_label_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:config.CalendarConfig.bottom_right_label)
 }
-inline void CalendarConfig::set_bottom_right_label(const char* value) {
-  set_has_bottom_right_label();
-  bottom_right_label_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:config.CalendarConfig.bottom_right_label)
+inline std::string* CalendarConfig::mutable_bottom_right_label() {
+  std::string* _s = _internal_mutable_bottom_right_label();
+  // @@protoc_insertion_point(field_mutable:config.CalendarConfig.bottom_right_label)
+  return _s;
+}
+inline const std::string& CalendarConfig::_internal_bottom_right_label() const {
+  return _impl_.bottom_right_label_.Get();
+}
+inline void CalendarConfig::_internal_set_bottom_right_label(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.bottom_right_label_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CalendarConfig::_internal_mutable_bottom_right_label() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.bottom_right_label_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CalendarConfig::release_bottom_right_label() {
+  // @@protoc_insertion_point(field_release:config.CalendarConfig.bottom_right_label)
+  if (!_internal_has_bottom_right_label()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.bottom_right_label_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.bottom_right_label_.IsDefault()) {
+    _impl_.bottom_right_label_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void CalendarConfig::set_allocated_bottom_right_label(std::string* bottom_right_label) {
+  if (bottom_right_label != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.bottom_right_label_.SetAllocated(bottom_right_label, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.bottom_right_label_.IsDefault()) {
+    _impl_.bottom_right_label_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:config.CalendarConfig.bottom_right_label)
+}
+
+// optional string header_font_family = 18;
+inline bool CalendarConfig::_internal_has_header_font_family() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool CalendarConfig::has_header_font_family() const {
+  return _internal_has_header_font_family();
+}
+inline void CalendarConfig::clear_header_font_family() {
+  _impl_.header_font_family_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline const std::string& CalendarConfig::header_font_family() const {
+  // @@protoc_insertion_point(field_get:config.CalendarConfig.header_font_family)
+  return _internal_header_font_family();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CalendarConfig::set_header_font_family(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000004u;
+ _impl_.header_font_family_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:config.CalendarConfig.header_font_family)
+}
+inline std::string* CalendarConfig::mutable_header_font_family() {
+  std::string* _s = _internal_mutable_header_font_family();
+  // @@protoc_insertion_point(field_mutable:config.CalendarConfig.header_font_family)
+  return _s;
+}
+inline const std::string& CalendarConfig::_internal_header_font_family() const {
+  return _impl_.header_font_family_.Get();
+}
+inline void CalendarConfig::_internal_set_header_font_family(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.header_font_family_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CalendarConfig::_internal_mutable_header_font_family() {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  return _impl_.header_font_family_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CalendarConfig::release_header_font_family() {
+  // @@protoc_insertion_point(field_release:config.CalendarConfig.header_font_family)
+  if (!_internal_has_header_font_family()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  auto* p = _impl_.header_font_family_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.header_font_family_.IsDefault()) {
+    _impl_.header_font_family_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void CalendarConfig::set_allocated_header_font_family(std::string* header_font_family) {
+  if (header_font_family != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  _impl_.header_font_family_.SetAllocated(header_font_family, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.header_font_family_.IsDefault()) {
+    _impl_.header_font_family_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:config.CalendarConfig.header_font_family)
+}
+
+// optional string number_font_family = 19;
+inline bool CalendarConfig::_internal_has_number_font_family() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool CalendarConfig::has_number_font_family() const {
+  return _internal_has_number_font_family();
+}
+inline void CalendarConfig::clear_number_font_family() {
+  _impl_.number_font_family_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline const std::string& CalendarConfig::number_font_family() const {
+  // @@protoc_insertion_point(field_get:config.CalendarConfig.number_font_family)
+  return _internal_number_font_family();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CalendarConfig::set_number_font_family(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000008u;
+ _impl_.number_font_family_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:config.CalendarConfig.number_font_family)
+}
+inline std::string* CalendarConfig::mutable_number_font_family() {
+  std::string* _s = _internal_mutable_number_font_family();
+  // @@protoc_insertion_point(field_mutable:config.CalendarConfig.number_font_family)
+  return _s;
+}
+inline const std::string& CalendarConfig::_internal_number_font_family() const {
+  return _impl_.number_font_family_.Get();
+}
+inline void CalendarConfig::_internal_set_number_font_family(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.number_font_family_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CalendarConfig::_internal_mutable_number_font_family() {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  return _impl_.number_font_family_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CalendarConfig::release_number_font_family() {
+  // @@protoc_insertion_point(field_release:config.CalendarConfig.number_font_family)
+  if (!_internal_has_number_font_family()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  auto* p = _impl_.number_font_family_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.number_font_family_.IsDefault()) {
+    _impl_.number_font_family_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void CalendarConfig::set_allocated_number_font_family(std::string* number_font_family) {
+  if (number_font_family != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000008u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000008u;
+  }
+  _impl_.number_font_family_.SetAllocated(number_font_family, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.number_font_family_.IsDefault()) {
+    _impl_.number_font_family_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:config.CalendarConfig.number_font_family)
+}
+
+// optional string quote_font_family = 20;
+inline bool CalendarConfig::_internal_has_quote_font_family() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool CalendarConfig::has_quote_font_family() const {
+  return _internal_has_quote_font_family();
+}
+inline void CalendarConfig::clear_quote_font_family() {
+  _impl_.quote_font_family_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline const std::string& CalendarConfig::quote_font_family() const {
+  // @@protoc_insertion_point(field_get:config.CalendarConfig.quote_font_family)
+  return _internal_quote_font_family();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CalendarConfig::set_quote_font_family(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000010u;
+ _impl_.quote_font_family_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:config.CalendarConfig.quote_font_family)
+}
+inline std::string* CalendarConfig::mutable_quote_font_family() {
+  std::string* _s = _internal_mutable_quote_font_family();
+  // @@protoc_insertion_point(field_mutable:config.CalendarConfig.quote_font_family)
+  return _s;
+}
+inline const std::string& CalendarConfig::_internal_quote_font_family() const {
+  return _impl_.quote_font_family_.Get();
+}
+inline void CalendarConfig::_internal_set_quote_font_family(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.quote_font_family_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CalendarConfig::_internal_mutable_quote_font_family() {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  return _impl_.quote_font_family_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CalendarConfig::release_quote_font_family() {
+  // @@protoc_insertion_point(field_release:config.CalendarConfig.quote_font_family)
+  if (!_internal_has_quote_font_family()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000010u;
+  auto* p = _impl_.quote_font_family_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.quote_font_family_.IsDefault()) {
+    _impl_.quote_font_family_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void CalendarConfig::set_allocated_quote_font_family(std::string* quote_font_family) {
+  if (quote_font_family != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000010u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000010u;
+  }
+  _impl_.quote_font_family_.SetAllocated(quote_font_family, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.quote_font_family_.IsDefault()) {
+    _impl_.quote_font_family_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:config.CalendarConfig.quote_font_family)
+}
+
+// optional bool dotted_line = 21 [default = false];
+inline bool CalendarConfig::_internal_has_dotted_line() const {
+  bool value = (_impl_._has_bits_[0] & 0x00040000u) != 0;
+  return value;
+}
+inline bool CalendarConfig::has_dotted_line() const {
+  return _internal_has_dotted_line();
+}
+inline void CalendarConfig::clear_dotted_line() {
+  _impl_.dotted_line_ = false;
+  _impl_._has_bits_[0] &= ~0x00040000u;
+}
+inline bool CalendarConfig::_internal_dotted_line() const {
+  return _impl_.dotted_line_;
+}
+inline bool CalendarConfig::dotted_line() const {
+  // @@protoc_insertion_point(field_get:config.CalendarConfig.dotted_line)
+  return _internal_dotted_line();
+}
+inline void CalendarConfig::_internal_set_dotted_line(bool value) {
+  _impl_._has_bits_[0] |= 0x00040000u;
+  _impl_.dotted_line_ = value;
+}
+inline void CalendarConfig::set_dotted_line(bool value) {
+  _internal_set_dotted_line(value);
+  // @@protoc_insertion_point(field_set:config.CalendarConfig.dotted_line)
+}
+
+// optional double vertical_dotted_line_x = 22;
+inline bool CalendarConfig::_internal_has_vertical_dotted_line_x() const {
+  bool value = (_impl_._has_bits_[0] & 0x00020000u) != 0;
+  return value;
+}
+inline bool CalendarConfig::has_vertical_dotted_line_x() const {
+  return _internal_has_vertical_dotted_line_x();
+}
+inline void CalendarConfig::clear_vertical_dotted_line_x() {
+  _impl_.vertical_dotted_line_x_ = 0;
+  _impl_._has_bits_[0] &= ~0x00020000u;
+}
+inline double CalendarConfig::_internal_vertical_dotted_line_x() const {
+  return _impl_.vertical_dotted_line_x_;
+}
+inline double CalendarConfig::vertical_dotted_line_x() const {
+  // @@protoc_insertion_point(field_get:config.CalendarConfig.vertical_dotted_line_x)
+  return _internal_vertical_dotted_line_x();
+}
+inline void CalendarConfig::_internal_set_vertical_dotted_line_x(double value) {
+  _impl_._has_bits_[0] |= 0x00020000u;
+  _impl_.vertical_dotted_line_x_ = value;
 }
-inline void CalendarConfig::set_bottom_right_label(const char* value, size_t size) {
-  set_has_bottom_right_label();
-  bottom_right_label_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:config.CalendarConfig.bottom_right_label)
+inline void CalendarConfig::set_vertical_dotted_line_x(double value) {
+  _internal_set_vertical_dotted_line_x(value);
+  // @@protoc_insertion_point(field_set:config.CalendarConfig.vertical_dotted_line_x)
 }
-inline ::std::string* CalendarConfig::mutable_bottom_right_label() {
-  set_has_bottom_right_label();
-  // @@protoc_insertion_point(field_mutable:config.CalendarConfig.bottom_right_label)
-  return bottom_right_label_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+
+// optional .config.OutputType output_type = 23 [default = SVG];
+inline bool CalendarConfig::_internal_has_output_type() const {
+  bool value = (_impl_._has_bits_[0] & 0x00080000u) != 0;
+  return value;
 }
-inline ::std::string* CalendarConfig::release_bottom_right_label() {
-  // @@protoc_insertion_point(field_release:config.CalendarConfig.bottom_right_label)
-  clear_has_bottom_right_label();
-  return bottom_right_label_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline bool CalendarConfig::has_output_type() const {
+  return _internal_has_output_type();
 }
-inline void CalendarConfig::set_allocated_bottom_right_label(::std::string* bottom_right_label) {
-  if (bottom_right_label != NULL) {
-    set_has_bottom_right_label();
-  } else {
-    clear_has_bottom_right_label();
-  }
-  bottom_right_label_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), bottom_right_label);
-  // @@protoc_insertion_point(field_set_allocated:config.CalendarConfig.bottom_right_label)
+inline void CalendarConfig::clear_output_type() {
+  _impl_.output_type_ = 0;
+  _impl_._has_bits_[0] &= ~0x00080000u;
 }
-
-// optional string header_font_family = 18;
-inline bool CalendarConfig::has_header_font_family() const {
-  return (_has_bits_[0] & 0x00020000u) != 0;
+inline ::config::OutputType CalendarConfig::_internal_output_type() const {
+  return static_cast< ::config::OutputType >(_impl_.output_type_);
 }
-inline void CalendarConfig::set_has_header_font_family() {
-  _has_bits_[0] |= 0x00020000u;
+inline ::config::OutputType CalendarConfig::output_type() const {
+  // @@protoc_insertion_point(field_get:config.CalendarConfig.output_type)
+  return _internal_output_type();
 }
-inline void CalendarConfig::clear_has_header_font_family() {
-  _has_bits_[0] &= ~0x00020000u;
+inline void CalendarConfig::_internal_set_output_type(::config::OutputType value) {
+  assert(::config::OutputType_IsValid(value));
+  _impl_._has_bits_[0] |= 0x00080000u;
+  _impl_.output_type_ = value;
 }
-inline void CalendarConfig::clear_header_font_family() {
-  header_font_family_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  clear_has_header_font_family();
+inline void CalendarConfig::set_output_type(::config::OutputType value) {
+  _internal_set_output_type(value);
+  // @@protoc_insertion_point(field_set:config.CalendarConfig.output_type)
 }
-inline const ::std::string& CalendarConfig::header_font_family() const {
-  // @@protoc_insertion_point(field_get:config.CalendarConfig.header_font_family)
-  return header_font_family_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+
+// repeated .config.HolidayRule holiday = 24;
+inline int CalendarConfig::_internal_holiday_size() const {
+  return _impl_.holiday_.size();
 }
-inline void CalendarConfig::set_header_font_family(const ::std::string& value) {
-  set_has_header_font_family();
-  header_font_family_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:config.CalendarConfig.header_font_family)
+inline int CalendarConfig::holiday_size() const {
+  return _internal_holiday_size();
 }
-inline void CalendarConfig::set_header_font_family(const char* value) {
-  set_has_header_font_family();
-  header_font_family_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:config.CalendarConfig.header_font_family)
+inline void CalendarConfig::clear_holiday() {
+  _impl_.holiday_.Clear();
 }
-inline void CalendarConfig::set_header_font_family(const char* value, size_t size) {
-  set_has_header_font_family();
-  header_font_family_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:config.CalendarConfig.header_font_family)
+inline ::config::HolidayRule* CalendarConfig::mutable_holiday(int index) {
+  // @@protoc_insertion_point(field_mutable:config.CalendarConfig.holiday)
+  return _impl_.holiday_.Mutable(index);
 }
-inline ::std::string* CalendarConfig::mutable_header_font_family() {
-  set_has_header_font_family();
-  // @@protoc_insertion_point(field_mutable:config.CalendarConfig.header_font_family)
-  return header_font_family_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::config::HolidayRule >*
+CalendarConfig::mutable_holiday() {
+  // @@protoc_insertion_point(field_mutable_list:config.CalendarConfig.holiday)
+  return &_impl_.holiday_;
 }
-inline ::std::string* CalendarConfig::release_header_font_family() {
-  // @@protoc_insertion_point(field_release:config.CalendarConfig.header_font_family)
-  clear_has_header_font_family();
-  return header_font_family_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline const ::config::HolidayRule& CalendarConfig::_internal_holiday(int index) const {
+  return _impl_.holiday_.Get(index);
 }
-inline void CalendarConfig::set_allocated_header_font_family(::std::string* header_font_family) {
-  if (header_font_family != NULL) {
-    set_has_header_font_family();
-  } else {
-    clear_has_header_font_family();
-  }
-  header_font_family_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), header_font_family);
-  // @@protoc_insertion_point(field_set_allocated:config.CalendarConfig.header_font_family)
+inline const ::config::HolidayRule& CalendarConfig::holiday(int index) const {
+  // @@protoc_insertion_point(field_get:config.CalendarConfig.holiday)
+  return _internal_holiday(index);
 }
-
-// optional string number_font_family = 19;
-inline bool CalendarConfig::has_number_font_family() const {
-  return (_has_bits_[0] & 0x00040000u) != 0;
+inline ::config::HolidayRule* CalendarConfig::_internal_add_holiday() {
+  return _impl_.holiday_.Add();
 }
-inline void CalendarConfig::set_has_number_font_family() {
-  _has_bits_[0] |= 0x00040000u;
+inline ::config::HolidayRule* CalendarConfig::add_holiday() {
+  ::config::HolidayRule* _add = _internal_add_holiday();
+  // @@protoc_insertion_point(field_add:config.CalendarConfig.holiday)
+  return _add;
 }
-inline void CalendarConfig::clear_has_number_font_family() {
-  _has_bits_[0] &= ~0x00040000u;
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::config::HolidayRule >&
+CalendarConfig::holiday() const {
+  // @@protoc_insertion_point(field_list:config.CalendarConfig.holiday)
+  return _impl_.holiday_;
 }
-inline void CalendarConfig::clear_number_font_family() {
-  number_font_family_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  clear_has_number_font_family();
+
+// repeated .config.OutputType output_types = 25;
+inline int CalendarConfig::_internal_output_types_size() const {
+  return _impl_.output_types_.size();
 }
-inline const ::std::string& CalendarConfig::number_font_family() const {
-  // @@protoc_insertion_point(field_get:config.CalendarConfig.number_font_family)
-  return number_font_family_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline int CalendarConfig::output_types_size() const {
+  return _internal_output_types_size();
 }
-inline void CalendarConfig::set_number_font_family(const ::std::string& value) {
-  set_has_number_font_family();
-  number_font_family_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:config.CalendarConfig.number_font_family)
+inline void CalendarConfig::clear_output_types() {
+  _impl_.output_types_.Clear();
 }
-inline void CalendarConfig::set_number_font_family(const char* value) {
-  set_has_number_font_family();
-  number_font_family_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:config.CalendarConfig.number_font_family)
+inline ::config::OutputType CalendarConfig::_internal_output_types(int index) const {
+  return static_cast< ::config::OutputType >(_impl_.output_types_.Get(index));
 }
-inline void CalendarConfig::set_number_font_family(const char* value, size_t size) {
-  set_has_number_font_family();
-  number_font_family_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:config.CalendarConfig.number_font_family)
+inline ::config::OutputType CalendarConfig::output_types(int index) const {
+  // @@protoc_insertion_point(field_get:config.CalendarConfig.output_types)
+  return _internal_output_types(index);
 }
-inline ::std::string* CalendarConfig::mutable_number_font_family() {
-  set_has_number_font_family();
-  // @@protoc_insertion_point(field_mutable:config.CalendarConfig.number_font_family)
-  return number_font_family_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline void CalendarConfig::set_output_types(int index, ::config::OutputType value) {
+  assert(::config::OutputType_IsValid(value));
+  _impl_.output_types_.Set(index, value);
+  // @@protoc_insertion_point(field_set:config.CalendarConfig.output_types)
 }
-inline ::std::string* CalendarConfig::release_number_font_family() {
-  // @@protoc_insertion_point(field_release:config.CalendarConfig.number_font_family)
-  clear_has_number_font_family();
-  return number_font_family_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline void CalendarConfig::_internal_add_output_types(::config::OutputType value) {
+  assert(::config::OutputType_IsValid(value));
+  _impl_.output_types_.Add(value);
+}
+inline void CalendarConfig::add_output_types(::config::OutputType value) {
+  _internal_add_output_types(value);
+  // @@protoc_insertion_point(field_add:config.CalendarConfig.output_types)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField<int>&
+CalendarConfig::output_types() const {
+  // @@protoc_insertion_point(field_list:config.CalendarConfig.output_types)
+  return _impl_.output_types_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField<int>*
+CalendarConfig::_internal_mutable_output_types() {
+  return &_impl_.output_types_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField<int>*
+CalendarConfig::mutable_output_types() {
+  // @@protoc_insertion_point(field_mutable_list:config.CalendarConfig.output_types)
+  return _internal_mutable_output_types();
+}
+
+// optional string output_name = 26 [default = "example"];
+inline bool CalendarConfig::_internal_has_output_name() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
+inline bool CalendarConfig::has_output_name() const {
+  return _internal_has_output_name();
+}
+inline void CalendarConfig::clear_output_name() {
+  _impl_.output_name_.ClearToDefault(::config::CalendarConfig::Impl_::_i_give_permission_to_break_this_code_default_output_name_, GetArenaForAllocation());
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline const std::string& CalendarConfig::output_name() const {
+  // @@protoc_insertion_point(field_get:config.CalendarConfig.output_name)
+  if (_impl_.output_name_.IsDefault()) return Impl_::_i_give_permission_to_break_this_code_default_output_name_.get();
+  return _internal_output_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CalendarConfig::set_output_name(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000020u;
+ _impl_.output_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:config.CalendarConfig.output_name)
+}
+inline std::string* CalendarConfig::mutable_output_name() {
+  std::string* _s = _internal_mutable_output_name();
+  // @@protoc_insertion_point(field_mutable:config.CalendarConfig.output_name)
+  return _s;
+}
+inline const std::string& CalendarConfig::_internal_output_name() const {
+  return _impl_.output_name_.Get();
+}
+inline void CalendarConfig::_internal_set_output_name(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.output_name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CalendarConfig::_internal_mutable_output_name() {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  return _impl_.output_name_.Mutable(::config::CalendarConfig::Impl_::_i_give_permission_to_break_this_code_default_output_name_, GetArenaForAllocation());
+}
+inline std::string* CalendarConfig::release_output_name() {
+  // @@protoc_insertion_point(field_release:config.CalendarConfig.output_name)
+  if (!_internal_has_output_name()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000020u;
+  auto* p = _impl_.output_name_.Release();
+  return p;
 }
-inline void CalendarConfig::set_allocated_number_font_family(::std::string* number_font_family) {
-  if (number_font_family != NULL) {
-    set_has_number_font_family();
+inline void CalendarConfig::set_allocated_output_name(std::string* output_name) {
+  if (output_name != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000020u;
   } else {
-    clear_has_number_font_family();
+    _impl_._has_bits_[0] &= ~0x00000020u;
   }
-  number_font_family_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), number_font_family);
-  // @@protoc_insertion_point(field_set_allocated:config.CalendarConfig.number_font_family)
+  _impl_.output_name_.SetAllocated(output_name, GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set_allocated:config.CalendarConfig.output_name)
 }
 
-// optional string quote_font_family = 20;
-inline bool CalendarConfig::has_quote_font_family() const {
-  return (_has_bits_[0] & 0x00080000u) != 0;
-}
-inline void CalendarConfig::set_has_quote_font_family() {
-  _has_bits_[0] |= 0x00080000u;
-}
-inline void CalendarConfig::clear_has_quote_font_family() {
-  _has_bits_[0] &= ~0x00080000u;
-}
-inline void CalendarConfig::clear_quote_font_family() {
-  quote_font_family_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  clear_has_quote_font_family();
+// optional int32 render_threads = 27 [default = 1];
+inline bool CalendarConfig::_internal_has_render_threads() const {
+  bool value = (_impl_._has_bits_[0] & 0x04000000u) != 0;
+  return value;
 }
-inline const ::std::string& CalendarConfig::quote_font_family() const {
-  // @@protoc_insertion_point(field_get:config.CalendarConfig.quote_font_family)
-  return quote_font_family_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-inline void CalendarConfig::set_quote_font_family(const ::std::string& value) {
-  set_has_quote_font_family();
-  quote_font_family_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:config.CalendarConfig.quote_font_family)
+inline bool CalendarConfig::has_render_threads() const {
+  return _internal_has_render_threads();
 }
-inline void CalendarConfig::set_quote_font_family(const char* value) {
-  set_has_quote_font_family();
-  quote_font_family_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:config.CalendarConfig.quote_font_family)
+inline void CalendarConfig::clear_render_threads() {
+  _impl_.render_threads_ = 1;
+  _impl_._has_bits_[0] &= ~0x04000000u;
 }
-inline void CalendarConfig::set_quote_font_family(const char* value, size_t size) {
-  set_has_quote_font_family();
-  quote_font_family_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:config.CalendarConfig.quote_font_family)
+inline int32_t CalendarConfig::_internal_render_threads() const {
+  return _impl_.render_threads_;
 }
-inline ::std::string* CalendarConfig::mutable_quote_font_family() {
-  set_has_quote_font_family();
-  // @@protoc_insertion_point(field_mutable:config.CalendarConfig.quote_font_family)
-  return quote_font_family_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline int32_t CalendarConfig::render_threads() const {
+  // @@protoc_insertion_point(field_get:config.CalendarConfig.render_threads)
+  return _internal_render_threads();
 }
-inline ::std::string* CalendarConfig::release_quote_font_family() {
-  // @@protoc_insertion_point(field_release:config.CalendarConfig.quote_font_family)
-  clear_has_quote_font_family();
-  return quote_font_family_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline void CalendarConfig::_internal_set_render_threads(int32_t value) {
+  _impl_._has_bits_[0] |= 0x04000000u;
+  _impl_.render_threads_ = value;
 }
-inline void CalendarConfig::set_allocated_quote_font_family(::std::string* quote_font_family) {
-  if (quote_font_family != NULL) {
-    set_has_quote_font_family();
-  } else {
-    clear_has_quote_font_family();
-  }
-  quote_font_family_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), quote_font_family);
-  // @@protoc_insertion_point(field_set_allocated:config.CalendarConfig.quote_font_family)
+inline void CalendarConfig::set_render_threads(int32_t value) {
+  _internal_set_render_threads(value);
+  // @@protoc_insertion_point(field_set:config.CalendarConfig.render_threads)
 }
 
-// optional bool dotted_line = 21 [default = false];
-inline bool CalendarConfig::has_dotted_line() const {
-  return (_has_bits_[0] & 0x00100000u) != 0;
+// optional int32 tile_height = 28;
+inline bool CalendarConfig::_internal_has_tile_height() const {
+  bool value = (_impl_._has_bits_[0] & 0x00100000u) != 0;
+  return value;
 }
-inline void CalendarConfig::set_has_dotted_line() {
-  _has_bits_[0] |= 0x00100000u;
+inline bool CalendarConfig::has_tile_height() const {
+  return _internal_has_tile_height();
 }
-inline void CalendarConfig::clear_has_dotted_line() {
-  _has_bits_[0] &= ~0x00100000u;
+inline void CalendarConfig::clear_tile_height() {
+  _impl_.tile_height_ = 0;
+  _impl_._has_bits_[0] &= ~0x00100000u;
 }
-inline void CalendarConfig::clear_dotted_line() {
-  dotted_line_ = false;
-  clear_has_dotted_line();
+inline int32_t CalendarConfig::_internal_tile_height() const {
+  return _impl_.tile_height_;
 }
-inline bool CalendarConfig::dotted_line() const {
-  // @@protoc_insertion_point(field_get:config.CalendarConfig.dotted_line)
-  return dotted_line_;
+inline int32_t CalendarConfig::tile_height() const {
+  // @@protoc_insertion_point(field_get:config.CalendarConfig.tile_height)
+  return _internal_tile_height();
 }
-inline void CalendarConfig::set_dotted_line(bool value) {
-  set_has_dotted_line();
-  dotted_line_ = value;
-  // @@protoc_insertion_point(field_set:config.CalendarConfig.dotted_line)
+inline void CalendarConfig::_internal_set_tile_height(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00100000u;
+  _impl_.tile_height_ = value;
+}
+inline void CalendarConfig::set_tile_height(int32_t value) {
+  _internal_set_tile_height(value);
+  // @@protoc_insertion_point(field_set:config.CalendarConfig.tile_height)
 }
 
-// optional double vertical_dotted_line_x = 22;
-inline bool CalendarConfig::has_vertical_dotted_line_x() const {
-  return (_has_bits_[0] & 0x00200000u) != 0;
+// optional int32 start_year = 29;
+inline bool CalendarConfig::_internal_has_start_year() const {
+  bool value = (_impl_._has_bits_[0] & 0x00200000u) != 0;
+  return value;
 }
-inline void CalendarConfig::set_has_vertical_dotted_line_x() {
-  _has_bits_[0] |= 0x00200000u;
+inline bool CalendarConfig::has_start_year() const {
+  return _internal_has_start_year();
 }
-inline void CalendarConfig::clear_has_vertical_dotted_line_x() {
-  _has_bits_[0] &= ~0x00200000u;
+inline void CalendarConfig::clear_start_year() {
+  _impl_.start_year_ = 0;
+  _impl_._has_bits_[0] &= ~0x00200000u;
 }
-inline void CalendarConfig::clear_vertical_dotted_line_x() {
-  vertical_dotted_line_x_ = 0;
-  clear_has_vertical_dotted_line_x();
+inline int32_t CalendarConfig::_internal_start_year() const {
+  return _impl_.start_year_;
 }
-inline double CalendarConfig::vertical_dotted_line_x() const {
-  // @@protoc_insertion_point(field_get:config.CalendarConfig.vertical_dotted_line_x)
-  return vertical_dotted_line_x_;
+inline int32_t CalendarConfig::start_year() const {
+  // @@protoc_insertion_point(field_get:config.CalendarConfig.start_year)
+  return _internal_start_year();
 }
-inline void CalendarConfig::set_vertical_dotted_line_x(double value) {
-  set_has_vertical_dotted_line_x();
-  vertical_dotted_line_x_ = value;
-  // @@protoc_insertion_point(field_set:config.CalendarConfig.vertical_dotted_line_x)
+inline void CalendarConfig::_internal_set_start_year(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00200000u;
+  _impl_.start_year_ = value;
+}
+inline void CalendarConfig::set_start_year(int32_t value) {
+  _internal_set_start_year(value);
+  // @@protoc_insertion_point(field_set:config.CalendarConfig.start_year)
 }
 
-// optional .config.OutputType output_type = 23 [default = SVG];
-inline bool CalendarConfig::has_output_type() const {
-  return (_has_bits_[0] & 0x00400000u) != 0;
+// optional bool share_svg_paths = 30 [default = true];
+inline bool CalendarConfig::_internal_has_share_svg_paths() const {
+  bool value = (_impl_._has_bits_[0] & 0x00400000u) != 0;
+  return value;
 }
-inline void CalendarConfig::set_has_output_type() {
-  _has_bits_[0] |= 0x00400000u;
+inline bool CalendarConfig::has_share_svg_paths() const {
+  return _internal_has_share_svg_paths();
 }
-inline void CalendarConfig::clear_has_output_type() {
-  _has_bits_[0] &= ~0x00400000u;
+inline void CalendarConfig::clear_share_svg_paths() {
+  _impl_.share_svg_paths_ = true;
+  _impl_._has_bits_[0] &= ~0x00400000u;
 }
-inline void CalendarConfig::clear_output_type() {
-  output_type_ = 0;
-  clear_has_output_type();
+inline bool CalendarConfig::_internal_share_svg_paths() const {
+  return _impl_.share_svg_paths_;
 }
-inline ::config::OutputType CalendarConfig::output_type() const {
-  // @@protoc_insertion_point(field_get:config.CalendarConfig.output_type)
-  return static_cast< ::config::OutputType >(output_type_);
+inline bool CalendarConfig::share_svg_paths() const {
+  // @@protoc_insertion_point(field_get:config.CalendarConfig.share_svg_paths)
+  return _internal_share_svg_paths();
 }
-inline void CalendarConfig::set_output_type(::config::OutputType value) {
-  assert(::config::OutputType_IsValid(value));
-  set_has_output_type();
-  output_type_ = value;
-  // @@protoc_insertion_point(field_set:config.CalendarConfig.output_type)
+inline void CalendarConfig::_internal_set_share_svg_paths(bool value) {
+  _impl_._has_bits_[0] |= 0x00400000u;
+  _impl_.share_svg_paths_ = value;
+}
+inline void CalendarConfig::set_share_svg_paths(bool value) {
+  _internal_set_share_svg_paths(value);
+  // @@protoc_insertion_point(field_set:config.CalendarConfig.share_svg_paths)
 }
 
 // -------------------------------------------------------------------
@@ -1481,196 +3034,272 @@ inline void CalendarConfig::set_output_type(::config::OutputType value) {
 // SpecialDay
 
 // required int32 month = 1;
-inline bool SpecialDay::has_month() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+inline bool SpecialDay::_internal_has_month() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
 }
-inline void SpecialDay::set_has_month() {
-  _has_bits_[0] |= 0x00000001u;
-}
-inline void SpecialDay::clear_has_month() {
-  _has_bits_[0] &= ~0x00000001u;
+inline bool SpecialDay::has_month() const {
+  return _internal_has_month();
 }
 inline void SpecialDay::clear_month() {
-  month_ = 0;
-  clear_has_month();
+  _impl_.month_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000004u;
 }
-inline ::google::protobuf::int32 SpecialDay::month() const {
+inline int32_t SpecialDay::_internal_month() const {
+  return _impl_.month_;
+}
+inline int32_t SpecialDay::month() const {
   // @@protoc_insertion_point(field_get:config.SpecialDay.month)
-  return month_;
+  return _internal_month();
+}
+inline void SpecialDay::_internal_set_month(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.month_ = value;
 }
-inline void SpecialDay::set_month(::google::protobuf::int32 value) {
-  set_has_month();
-  month_ = value;
+inline void SpecialDay::set_month(int32_t value) {
+  _internal_set_month(value);
   // @@protoc_insertion_point(field_set:config.SpecialDay.month)
 }
 
 // required int32 day = 2;
-inline bool SpecialDay::has_day() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
-}
-inline void SpecialDay::set_has_day() {
-  _has_bits_[0] |= 0x00000002u;
+inline bool SpecialDay::_internal_has_day() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
 }
-inline void SpecialDay::clear_has_day() {
-  _has_bits_[0] &= ~0x00000002u;
+inline bool SpecialDay::has_day() const {
+  return _internal_has_day();
 }
 inline void SpecialDay::clear_day() {
-  day_ = 0;
-  clear_has_day();
+  _impl_.day_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline int32_t SpecialDay::_internal_day() const {
+  return _impl_.day_;
 }
-inline ::google::protobuf::int32 SpecialDay::day() const {
+inline int32_t SpecialDay::day() const {
   // @@protoc_insertion_point(field_get:config.SpecialDay.day)
-  return day_;
+  return _internal_day();
 }
-inline void SpecialDay::set_day(::google::protobuf::int32 value) {
-  set_has_day();
-  day_ = value;
+inline void SpecialDay::_internal_set_day(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.day_ = value;
+}
+inline void SpecialDay::set_day(int32_t value) {
+  _internal_set_day(value);
   // @@protoc_insertion_point(field_set:config.SpecialDay.day)
 }
 
 // optional string svg = 3;
-inline bool SpecialDay::has_svg() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
+inline bool SpecialDay::_internal_has_svg() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
 }
-inline void SpecialDay::set_has_svg() {
-  _has_bits_[0] |= 0x00000004u;
-}
-inline void SpecialDay::clear_has_svg() {
-  _has_bits_[0] &= ~0x00000004u;
+inline bool SpecialDay::has_svg() const {
+  return _internal_has_svg();
 }
 inline void SpecialDay::clear_svg() {
-  svg_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  clear_has_svg();
+  _impl_.svg_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
 }
-inline const ::std::string& SpecialDay::svg() const {
+inline const std::string& SpecialDay::svg() const {
   // @@protoc_insertion_point(field_get:config.SpecialDay.svg)
-  return svg_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _internal_svg();
 }
-inline void SpecialDay::set_svg(const ::std::string& value) {
-  set_has_svg();
-  svg_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SpecialDay::set_svg(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.svg_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:config.SpecialDay.svg)
 }
-inline void SpecialDay::set_svg(const char* value) {
-  set_has_svg();
-  svg_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:config.SpecialDay.svg)
+inline std::string* SpecialDay::mutable_svg() {
+  std::string* _s = _internal_mutable_svg();
+  // @@protoc_insertion_point(field_mutable:config.SpecialDay.svg)
+  return _s;
 }
-inline void SpecialDay::set_svg(const char* value, size_t size) {
-  set_has_svg();
-  svg_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:config.SpecialDay.svg)
+inline const std::string& SpecialDay::_internal_svg() const {
+  return _impl_.svg_.Get();
 }
-inline ::std::string* SpecialDay::mutable_svg() {
-  set_has_svg();
-  // @@protoc_insertion_point(field_mutable:config.SpecialDay.svg)
-  return svg_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline void SpecialDay::_internal_set_svg(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.svg_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* SpecialDay::release_svg() {
+inline std::string* SpecialDay::_internal_mutable_svg() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.svg_.Mutable(GetArenaForAllocation());
+}
+inline std::string* SpecialDay::release_svg() {
   // @@protoc_insertion_point(field_release:config.SpecialDay.svg)
-  clear_has_svg();
-  return svg_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  if (!_internal_has_svg()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.svg_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.svg_.IsDefault()) {
+    _impl_.svg_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
 }
-inline void SpecialDay::set_allocated_svg(::std::string* svg) {
-  if (svg != NULL) {
-    set_has_svg();
+inline void SpecialDay::set_allocated_svg(std::string* svg) {
+  if (svg != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
   } else {
-    clear_has_svg();
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.svg_.SetAllocated(svg, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.svg_.IsDefault()) {
+    _impl_.svg_.Set("", GetArenaForAllocation());
   }
-  svg_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), svg);
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:config.SpecialDay.svg)
 }
 
 // optional int32 first_year = 4;
-inline bool SpecialDay::has_first_year() const {
-  return (_has_bits_[0] & 0x00000008u) != 0;
-}
-inline void SpecialDay::set_has_first_year() {
-  _has_bits_[0] |= 0x00000008u;
+inline bool SpecialDay::_internal_has_first_year() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
 }
-inline void SpecialDay::clear_has_first_year() {
-  _has_bits_[0] &= ~0x00000008u;
+inline bool SpecialDay::has_first_year() const {
+  return _internal_has_first_year();
 }
 inline void SpecialDay::clear_first_year() {
-  first_year_ = 0;
-  clear_has_first_year();
+  _impl_.first_year_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline int32_t SpecialDay::_internal_first_year() const {
+  return _impl_.first_year_;
 }
-inline ::google::protobuf::int32 SpecialDay::first_year() const {
+inline int32_t SpecialDay::first_year() const {
   // @@protoc_insertion_point(field_get:config.SpecialDay.first_year)
-  return first_year_;
+  return _internal_first_year();
 }
-inline void SpecialDay::set_first_year(::google::protobuf::int32 value) {
-  set_has_first_year();
-  first_year_ = value;
+inline void SpecialDay::_internal_set_first_year(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.first_year_ = value;
+}
+inline void SpecialDay::set_first_year(int32_t value) {
+  _internal_set_first_year(value);
   // @@protoc_insertion_point(field_set:config.SpecialDay.first_year)
 }
 
 // optional int32 year = 5;
-inline bool SpecialDay::has_year() const {
-  return (_has_bits_[0] & 0x00000010u) != 0;
+inline bool SpecialDay::_internal_has_year() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
 }
-inline void SpecialDay::set_has_year() {
-  _has_bits_[0] |= 0x00000010u;
-}
-inline void SpecialDay::clear_has_year() {
-  _has_bits_[0] &= ~0x00000010u;
+inline bool SpecialDay::has_year() const {
+  return _internal_has_year();
 }
 inline void SpecialDay::clear_year() {
-  year_ = 0;
-  clear_has_year();
+  _impl_.year_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000020u;
 }
-inline ::google::protobuf::int32 SpecialDay::year() const {
+inline int32_t SpecialDay::_internal_year() const {
+  return _impl_.year_;
+}
+inline int32_t SpecialDay::year() const {
   // @@protoc_insertion_point(field_get:config.SpecialDay.year)
-  return year_;
+  return _internal_year();
+}
+inline void SpecialDay::_internal_set_year(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.year_ = value;
 }
-inline void SpecialDay::set_year(::google::protobuf::int32 value) {
-  set_has_year();
-  year_ = value;
+inline void SpecialDay::set_year(int32_t value) {
+  _internal_set_year(value);
   // @@protoc_insertion_point(field_set:config.SpecialDay.year)
 }
 
 // optional .config.RGB rgb = 6;
-inline bool SpecialDay::has_rgb() const {
-  return (_has_bits_[0] & 0x00000020u) != 0;
-}
-inline void SpecialDay::set_has_rgb() {
-  _has_bits_[0] |= 0x00000020u;
+inline bool SpecialDay::_internal_has_rgb() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.rgb_ != nullptr);
+  return value;
 }
-inline void SpecialDay::clear_has_rgb() {
-  _has_bits_[0] &= ~0x00000020u;
+inline bool SpecialDay::has_rgb() const {
+  return _internal_has_rgb();
 }
 inline void SpecialDay::clear_rgb() {
-  if (rgb_ != NULL) rgb_->::config::RGB::Clear();
-  clear_has_rgb();
+  if (_impl_.rgb_ != nullptr) _impl_.rgb_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const ::config::RGB& SpecialDay::_internal_rgb() const {
+  const ::config::RGB* p = _impl_.rgb_;
+  return p != nullptr ? *p : reinterpret_cast<const ::config::RGB&>(
+      ::config::_RGB_default_instance_);
 }
 inline const ::config::RGB& SpecialDay::rgb() const {
   // @@protoc_insertion_point(field_get:config.SpecialDay.rgb)
-  return rgb_ != NULL ? *rgb_ : *default_instance_->rgb_;
+  return _internal_rgb();
 }
-inline ::config::RGB* SpecialDay::mutable_rgb() {
-  set_has_rgb();
-  if (rgb_ == NULL) {
-    rgb_ = new ::config::RGB;
+inline void SpecialDay::unsafe_arena_set_allocated_rgb(
+    ::config::RGB* rgb) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.rgb_);
   }
-  // @@protoc_insertion_point(field_mutable:config.SpecialDay.rgb)
-  return rgb_;
+  _impl_.rgb_ = rgb;
+  if (rgb) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:config.SpecialDay.rgb)
 }
 inline ::config::RGB* SpecialDay::release_rgb() {
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::config::RGB* temp = _impl_.rgb_;
+  _impl_.rgb_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::config::RGB* SpecialDay::unsafe_arena_release_rgb() {
   // @@protoc_insertion_point(field_release:config.SpecialDay.rgb)
-  clear_has_rgb();
-  ::config::RGB* temp = rgb_;
-  rgb_ = NULL;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::config::RGB* temp = _impl_.rgb_;
+  _impl_.rgb_ = nullptr;
   return temp;
 }
+inline ::config::RGB* SpecialDay::_internal_mutable_rgb() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  if (_impl_.rgb_ == nullptr) {
+    auto* p = CreateMaybeMessage<::config::RGB>(GetArenaForAllocation());
+    _impl_.rgb_ = p;
+  }
+  return _impl_.rgb_;
+}
+inline ::config::RGB* SpecialDay::mutable_rgb() {
+  ::config::RGB* _msg = _internal_mutable_rgb();
+  // @@protoc_insertion_point(field_mutable:config.SpecialDay.rgb)
+  return _msg;
+}
 inline void SpecialDay::set_allocated_rgb(::config::RGB* rgb) {
-  delete rgb_;
-  rgb_ = rgb;
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.rgb_;
+  }
   if (rgb) {
-    set_has_rgb();
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(rgb);
+    if (message_arena != submessage_arena) {
+      rgb = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, rgb, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000002u;
   } else {
-    clear_has_rgb();
+    _impl_._has_bits_[0] &= ~0x00000002u;
   }
+  _impl_.rgb_ = rgb;
   // @@protoc_insertion_point(field_set_allocated:config.SpecialDay.rgb)
 }
 
@@ -1679,78 +3308,483 @@ inline void SpecialDay::set_allocated_rgb(::config::RGB* rgb) {
 // RGB
 
 // required int32 red = 1;
-inline bool RGB::has_red() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
-}
-inline void RGB::set_has_red() {
-  _has_bits_[0] |= 0x00000001u;
+inline bool RGB::_internal_has_red() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
 }
-inline void RGB::clear_has_red() {
-  _has_bits_[0] &= ~0x00000001u;
+inline bool RGB::has_red() const {
+  return _internal_has_red();
 }
 inline void RGB::clear_red() {
-  red_ = 0;
-  clear_has_red();
+  _impl_.red_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline int32_t RGB::_internal_red() const {
+  return _impl_.red_;
 }
-inline ::google::protobuf::int32 RGB::red() const {
+inline int32_t RGB::red() const {
   // @@protoc_insertion_point(field_get:config.RGB.red)
-  return red_;
+  return _internal_red();
 }
-inline void RGB::set_red(::google::protobuf::int32 value) {
-  set_has_red();
-  red_ = value;
+inline void RGB::_internal_set_red(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.red_ = value;
+}
+inline void RGB::set_red(int32_t value) {
+  _internal_set_red(value);
   // @@protoc_insertion_point(field_set:config.RGB.red)
 }
 
 // required int32 green = 2;
-inline bool RGB::has_green() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
+inline bool RGB::_internal_has_green() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
 }
-inline void RGB::set_has_green() {
-  _has_bits_[0] |= 0x00000002u;
-}
-inline void RGB::clear_has_green() {
-  _has_bits_[0] &= ~0x00000002u;
+inline bool RGB::has_green() const {
+  return _internal_has_green();
 }
 inline void RGB::clear_green() {
-  green_ = 0;
-  clear_has_green();
+  _impl_.green_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
 }
-inline ::google::protobuf::int32 RGB::green() const {
+inline int32_t RGB::_internal_green() const {
+  return _impl_.green_;
+}
+inline int32_t RGB::green() const {
   // @@protoc_insertion_point(field_get:config.RGB.green)
-  return green_;
+  return _internal_green();
+}
+inline void RGB::_internal_set_green(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.green_ = value;
 }
-inline void RGB::set_green(::google::protobuf::int32 value) {
-  set_has_green();
-  green_ = value;
+inline void RGB::set_green(int32_t value) {
+  _internal_set_green(value);
   // @@protoc_insertion_point(field_set:config.RGB.green)
 }
 
 // required int32 blue = 3;
-inline bool RGB::has_blue() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
-}
-inline void RGB::set_has_blue() {
-  _has_bits_[0] |= 0x00000004u;
+inline bool RGB::_internal_has_blue() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
 }
-inline void RGB::clear_has_blue() {
-  _has_bits_[0] &= ~0x00000004u;
+inline bool RGB::has_blue() const {
+  return _internal_has_blue();
 }
 inline void RGB::clear_blue() {
-  blue_ = 0;
-  clear_has_blue();
+  _impl_.blue_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline int32_t RGB::_internal_blue() const {
+  return _impl_.blue_;
 }
-inline ::google::protobuf::int32 RGB::blue() const {
+inline int32_t RGB::blue() const {
   // @@protoc_insertion_point(field_get:config.RGB.blue)
-  return blue_;
+  return _internal_blue();
 }
-inline void RGB::set_blue(::google::protobuf::int32 value) {
-  set_has_blue();
-  blue_ = value;
+inline void RGB::_internal_set_blue(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.blue_ = value;
+}
+inline void RGB::set_blue(int32_t value) {
+  _internal_set_blue(value);
   // @@protoc_insertion_point(field_set:config.RGB.blue)
 }
 
-#endif  // !PROTOBUF_INLINE_NOT_IN_HEADERS
+// -------------------------------------------------------------------
+
+// HolidayRule
+
+// optional string name = 1;
+inline bool HolidayRule::_internal_has_name() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool HolidayRule::has_name() const {
+  return _internal_has_name();
+}
+inline void HolidayRule::clear_name() {
+  _impl_.name_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& HolidayRule::name() const {
+  // @@protoc_insertion_point(field_get:config.HolidayRule.name)
+  return _internal_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void HolidayRule::set_name(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:config.HolidayRule.name)
+}
+inline std::string* HolidayRule::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:config.HolidayRule.name)
+  return _s;
+}
+inline const std::string& HolidayRule::_internal_name() const {
+  return _impl_.name_.Get();
+}
+inline void HolidayRule::_internal_set_name(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* HolidayRule::_internal_mutable_name() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* HolidayRule::release_name() {
+  // @@protoc_insertion_point(field_release:config.HolidayRule.name)
+  if (!_internal_has_name()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.name_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void HolidayRule::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:config.HolidayRule.name)
+}
+
+// required int32 month = 2;
+inline bool HolidayRule::_internal_has_month() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool HolidayRule::has_month() const {
+  return _internal_has_month();
+}
+inline void HolidayRule::clear_month() {
+  _impl_.month_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline int32_t HolidayRule::_internal_month() const {
+  return _impl_.month_;
+}
+inline int32_t HolidayRule::month() const {
+  // @@protoc_insertion_point(field_get:config.HolidayRule.month)
+  return _internal_month();
+}
+inline void HolidayRule::_internal_set_month(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.month_ = value;
+}
+inline void HolidayRule::set_month(int32_t value) {
+  _internal_set_month(value);
+  // @@protoc_insertion_point(field_set:config.HolidayRule.month)
+}
+
+// optional int32 day = 3;
+inline bool HolidayRule::_internal_has_day() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool HolidayRule::has_day() const {
+  return _internal_has_day();
+}
+inline void HolidayRule::clear_day() {
+  _impl_.day_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline int32_t HolidayRule::_internal_day() const {
+  return _impl_.day_;
+}
+inline int32_t HolidayRule::day() const {
+  // @@protoc_insertion_point(field_get:config.HolidayRule.day)
+  return _internal_day();
+}
+inline void HolidayRule::_internal_set_day(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.day_ = value;
+}
+inline void HolidayRule::set_day(int32_t value) {
+  _internal_set_day(value);
+  // @@protoc_insertion_point(field_set:config.HolidayRule.day)
+}
+
+// optional int32 wday = 4;
+inline bool HolidayRule::_internal_has_wday() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool HolidayRule::has_wday() const {
+  return _internal_has_wday();
+}
+inline void HolidayRule::clear_wday() {
+  _impl_.wday_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline int32_t HolidayRule::_internal_wday() const {
+  return _impl_.wday_;
+}
+inline int32_t HolidayRule::wday() const {
+  // @@protoc_insertion_point(field_get:config.HolidayRule.wday)
+  return _internal_wday();
+}
+inline void HolidayRule::_internal_set_wday(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.wday_ = value;
+}
+inline void HolidayRule::set_wday(int32_t value) {
+  _internal_set_wday(value);
+  // @@protoc_insertion_point(field_set:config.HolidayRule.wday)
+}
+
+// optional int32 week = 5;
+inline bool HolidayRule::_internal_has_week() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool HolidayRule::has_week() const {
+  return _internal_has_week();
+}
+inline void HolidayRule::clear_week() {
+  _impl_.week_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline int32_t HolidayRule::_internal_week() const {
+  return _impl_.week_;
+}
+inline int32_t HolidayRule::week() const {
+  // @@protoc_insertion_point(field_get:config.HolidayRule.week)
+  return _internal_week();
+}
+inline void HolidayRule::_internal_set_week(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.week_ = value;
+}
+inline void HolidayRule::set_week(int32_t value) {
+  _internal_set_week(value);
+  // @@protoc_insertion_point(field_set:config.HolidayRule.week)
+}
+
+// optional bool saturday_to_friday = 6 [default = false];
+inline bool HolidayRule::_internal_has_saturday_to_friday() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
+inline bool HolidayRule::has_saturday_to_friday() const {
+  return _internal_has_saturday_to_friday();
+}
+inline void HolidayRule::clear_saturday_to_friday() {
+  _impl_.saturday_to_friday_ = false;
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline bool HolidayRule::_internal_saturday_to_friday() const {
+  return _impl_.saturday_to_friday_;
+}
+inline bool HolidayRule::saturday_to_friday() const {
+  // @@protoc_insertion_point(field_get:config.HolidayRule.saturday_to_friday)
+  return _internal_saturday_to_friday();
+}
+inline void HolidayRule::_internal_set_saturday_to_friday(bool value) {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.saturday_to_friday_ = value;
+}
+inline void HolidayRule::set_saturday_to_friday(bool value) {
+  _internal_set_saturday_to_friday(value);
+  // @@protoc_insertion_point(field_set:config.HolidayRule.saturday_to_friday)
+}
+
+// optional bool sunday_to_monday = 7 [default = false];
+inline bool HolidayRule::_internal_has_sunday_to_monday() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  return value;
+}
+inline bool HolidayRule::has_sunday_to_monday() const {
+  return _internal_has_sunday_to_monday();
+}
+inline void HolidayRule::clear_sunday_to_monday() {
+  _impl_.sunday_to_monday_ = false;
+  _impl_._has_bits_[0] &= ~0x00000040u;
+}
+inline bool HolidayRule::_internal_sunday_to_monday() const {
+  return _impl_.sunday_to_monday_;
+}
+inline bool HolidayRule::sunday_to_monday() const {
+  // @@protoc_insertion_point(field_get:config.HolidayRule.sunday_to_monday)
+  return _internal_sunday_to_monday();
+}
+inline void HolidayRule::_internal_set_sunday_to_monday(bool value) {
+  _impl_._has_bits_[0] |= 0x00000040u;
+  _impl_.sunday_to_monday_ = value;
+}
+inline void HolidayRule::set_sunday_to_monday(bool value) {
+  _internal_set_sunday_to_monday(value);
+  // @@protoc_insertion_point(field_set:config.HolidayRule.sunday_to_monday)
+}
+
+// -------------------------------------------------------------------
+
+// CalendarBatch
+
+// repeated string config_file = 1;
+inline int CalendarBatch::_internal_config_file_size() const {
+  return _impl_.config_file_.size();
+}
+inline int CalendarBatch::config_file_size() const {
+  return _internal_config_file_size();
+}
+inline void CalendarBatch::clear_config_file() {
+  _impl_.config_file_.Clear();
+}
+inline std::string* CalendarBatch::add_config_file() {
+  std::string* _s = _internal_add_config_file();
+  // @@protoc_insertion_point(field_add_mutable:config.CalendarBatch.config_file)
+  return _s;
+}
+inline const std::string& CalendarBatch::_internal_config_file(int index) const {
+  return _impl_.config_file_.Get(index);
+}
+inline const std::string& CalendarBatch::config_file(int index) const {
+  // @@protoc_insertion_point(field_get:config.CalendarBatch.config_file)
+  return _internal_config_file(index);
+}
+inline std::string* CalendarBatch::mutable_config_file(int index) {
+  // @@protoc_insertion_point(field_mutable:config.CalendarBatch.config_file)
+  return _impl_.config_file_.Mutable(index);
+}
+inline void CalendarBatch::set_config_file(int index, const std::string& value) {
+  _impl_.config_file_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:config.CalendarBatch.config_file)
+}
+inline void CalendarBatch::set_config_file(int index, std::string&& value) {
+  _impl_.config_file_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:config.CalendarBatch.config_file)
+}
+inline void CalendarBatch::set_config_file(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.config_file_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:config.CalendarBatch.config_file)
+}
+inline void CalendarBatch::set_config_file(int index, const char* value, size_t size) {
+  _impl_.config_file_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:config.CalendarBatch.config_file)
+}
+inline std::string* CalendarBatch::_internal_add_config_file() {
+  return _impl_.config_file_.Add();
+}
+inline void CalendarBatch::add_config_file(const std::string& value) {
+  _impl_.config_file_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:config.CalendarBatch.config_file)
+}
+inline void CalendarBatch::add_config_file(std::string&& value) {
+  _impl_.config_file_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:config.CalendarBatch.config_file)
+}
+inline void CalendarBatch::add_config_file(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.config_file_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:config.CalendarBatch.config_file)
+}
+inline void CalendarBatch::add_config_file(const char* value, size_t size) {
+  _impl_.config_file_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:config.CalendarBatch.config_file)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+CalendarBatch::config_file() const {
+  // @@protoc_insertion_point(field_list:config.CalendarBatch.config_file)
+  return _impl_.config_file_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+CalendarBatch::mutable_config_file() {
+  // @@protoc_insertion_point(field_mutable_list:config.CalendarBatch.config_file)
+  return &_impl_.config_file_;
+}
+
+// repeated .config.CalendarConfig config = 2;
+inline int CalendarBatch::_internal_config_size() const {
+  return _impl_.config_.size();
+}
+inline int CalendarBatch::config_size() const {
+  return _internal_config_size();
+}
+inline void CalendarBatch::clear_config() {
+  _impl_.config_.Clear();
+}
+inline ::config::CalendarConfig* CalendarBatch::mutable_config(int index) {
+  // @@protoc_insertion_point(field_mutable:config.CalendarBatch.config)
+  return _impl_.config_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::config::CalendarConfig >*
+CalendarBatch::mutable_config() {
+  // @@protoc_insertion_point(field_mutable_list:config.CalendarBatch.config)
+  return &_impl_.config_;
+}
+inline const ::config::CalendarConfig& CalendarBatch::_internal_config(int index) const {
+  return _impl_.config_.Get(index);
+}
+inline const ::config::CalendarConfig& CalendarBatch::config(int index) const {
+  // @@protoc_insertion_point(field_get:config.CalendarBatch.config)
+  return _internal_config(index);
+}
+inline ::config::CalendarConfig* CalendarBatch::_internal_add_config() {
+  return _impl_.config_.Add();
+}
+inline ::config::CalendarConfig* CalendarBatch::add_config() {
+  ::config::CalendarConfig* _add = _internal_add_config();
+  // @@protoc_insertion_point(field_add:config.CalendarBatch.config)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::config::CalendarConfig >&
+CalendarBatch::config() const {
+  // @@protoc_insertion_point(field_list:config.CalendarBatch.config)
+  return _impl_.config_;
+}
+
+// optional int32 jobs = 3 [default = 1];
+inline bool CalendarBatch::_internal_has_jobs() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool CalendarBatch::has_jobs() const {
+  return _internal_has_jobs();
+}
+inline void CalendarBatch::clear_jobs() {
+  _impl_.jobs_ = 1;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline int32_t CalendarBatch::_internal_jobs() const {
+  return _impl_.jobs_;
+}
+inline int32_t CalendarBatch::jobs() const {
+  // @@protoc_insertion_point(field_get:config.CalendarBatch.jobs)
+  return _internal_jobs();
+}
+inline void CalendarBatch::_internal_set_jobs(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.jobs_ = value;
+}
+inline void CalendarBatch::set_jobs(int32_t value) {
+  _internal_set_jobs(value);
+  // @@protoc_insertion_point(field_set:config.CalendarBatch.jobs)
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
 // -------------------------------------------------------------------
 
 // -------------------------------------------------------------------
@@ -1760,20 +3794,17 @@ inline void RGB::set_blue(::google::protobuf::int32 value) {
 
 }  // namespace config
 
-#ifndef SWIG
-namespace google {
-namespace protobuf {
+PROTOBUF_NAMESPACE_OPEN
 
-template <> struct is_proto_enum< ::config::OutputType> : ::google::protobuf::internal::true_type {};
+template <> struct is_proto_enum< ::config::OutputType> : ::std::true_type {};
 template <>
 inline const EnumDescriptor* GetEnumDescriptor< ::config::OutputType>() {
   return ::config::OutputType_descriptor();
 }
 
-}  // namespace protobuf
-}  // namespace google
-#endif  // SWIG
+PROTOBUF_NAMESPACE_CLOSE
 
 // @@protoc_insertion_point(global_scope)
 
-#endif  // PROTOBUF_config_2eproto__INCLUDED
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_config_2eproto
@@ -0,0 +1,284 @@
+#include <errno.h>
+#include <signal.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/time.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include "calendar.h"
+#include "config.pb.h"
+#include "daemon.h"
+
+// Output is sent in chunks of up to this many bytes.
+const size_t REPLY_CHUNK_SIZE = 64 << 10;
+
+bool read_fully(int fd, void *buf, size_t length) {
+	char *p = static_cast<char*>(buf);
+	while (length > 0) {
+		ssize_t n = read(fd, p, length);
+		if (n < 0 && errno == EINTR) {
+			continue;
+		}
+		if (n <= 0) {
+			return false;
+		}
+		p += n;
+		length -= n;
+	}
+	return true;
+}
+
+bool write_fully(int fd, const void *buf, size_t length) {
+	const char *p = static_cast<const char*>(buf);
+	while (length > 0) {
+		ssize_t n = send(fd, p, length, MSG_NOSIGNAL);
+		if (n < 0 && errno == EINTR) {
+			continue;
+		}
+		if (n < 0) {
+			return false;
+		}
+		p += n;
+		length -= n;
+	}
+	return true;
+}
+
+void encode_uint32(uint32_t value, unsigned char *buf) {
+	buf[0] = value >> 24;
+	buf[1] = value >> 16;
+	buf[2] = value >> 8;
+	buf[3] = value;
+}
+
+uint32_t decode_uint32(const unsigned char *buf) {
+	return (uint32_t)buf[0] << 24 | (uint32_t)buf[1] << 16 |
+		(uint32_t)buf[2] << 8 | buf[3];
+}
+
+bool write_chunk(int fd, uint8_t kind, const char *data, size_t length) {
+	unsigned char header[5];
+	header[0] = kind;
+	encode_uint32(length, header + 1);
+	return write_fully(fd, header, sizeof(header)) &&
+		write_fully(fd, data, length);
+}
+
+// Collects the output of a render into chunks of REPLY_CHUNK_SIZE bytes,
+// so that cairo's many small writes do not each cost a system call.
+struct ReplyWriter {
+	int fd;
+	uint8_t kind;
+	std::string buffer;
+	// Cleared once the client is gone.
+	bool connected;
+};
+
+bool flush_reply(ReplyWriter *writer) {
+	if (writer->connected && !writer->buffer.empty()) {
+		writer->connected = write_chunk(writer->fd, writer->kind,
+				writer->buffer.data(), writer->buffer.size());
+	}
+	writer->buffer.clear();
+	return writer->connected;
+}
+
+bool write_reply(ReplyWriter *writer, config::OutputType output_type,
+		const unsigned char *data, size_t length) {
+	if (writer->kind != output_type ||
+			writer->buffer.size() + length > REPLY_CHUNK_SIZE) {
+		if (!flush_reply(writer)) {
+			return false;
+		}
+		writer->kind = output_type;
+	}
+	writer->buffer.append(reinterpret_cast<const char*>(data), length);
+	return true;
+}
+
+bool write_error(int fd, const std::string& message) {
+	return write_chunk(fd, DAEMON_CHUNK_ERROR, message.data(),
+			message.size());
+}
+
+// Sends every output of conf out of output_cache. Returns false without
+// sending anything unless all of them are cached; *connected is cleared if
+// the client went away meanwhile.
+bool send_cached_outputs(int fd, const config::CalendarConfig& conf,
+		OutputCache *output_cache, bool *connected) {
+	std::vector<config::OutputType> output_types = get_output_types(conf);
+	std::vector<int> cached_fds;
+	std::vector<off_t> sizes;
+	for (config::OutputType output_type : output_types) {
+		off_t size;
+		int cached_fd =
+			output_cache->open(get_output_key(conf, output_type), &size);
+		if (cached_fd < 0) {
+			break;
+		}
+		cached_fds.push_back(cached_fd);
+		sizes.push_back(size);
+	}
+
+	bool hit = cached_fds.size() == output_types.size();
+	*connected = true;
+	for (size_t i = 0; i < cached_fds.size(); i++) {
+		if (hit && *connected) {
+			unsigned char header[5];
+			header[0] = output_types[i];
+			encode_uint32(sizes[i], header + 1);
+			*connected = write_fully(fd, header, sizeof(header)) &&
+				copy_fd(fd, cached_fds[i], sizes[i]);
+		}
+		close(cached_fds[i]);
+	}
+	if (hit && *connected) {
+		*connected = write_chunk(fd, DAEMON_CHUNK_END, NULL, 0);
+	}
+	return hit;
+}
+
+// Answers requests until the client closes the connection.
+void serve_connection(const std::shared_ptr<spdlog::logger>& console,
+		int fd, RenderCache *cache, OutputCache *output_cache) {
+	for (;;) {
+		unsigned char header[4];
+		if (!read_fully(fd, header, sizeof(header))) {
+			return;
+		}
+		uint32_t length = decode_uint32(header);
+		if (length > DAEMON_MAX_REQUEST_SIZE) {
+			write_error(fd, "Request too large");
+			return;
+		}
+		std::string request(length, '\0');
+		if (!read_fully(fd, &request[0], length)) {
+			return;
+		}
+
+		config::CalendarConfig conf;
+		if (!conf.ParseFromString(request)) {
+			if (!write_error(fd, "Invalid CalendarConfig")) {
+				return;
+			}
+			continue;
+		}
+		bool connected;
+		if (output_cache != NULL &&
+				send_cached_outputs(fd, conf, output_cache, &connected)) {
+			if (!connected) {
+				return;
+			}
+			continue;
+		}
+		RenderContext *ctx = create_render_context(conf, console, cache);
+		if (ctx == NULL) {
+			if (!write_error(fd, "Invalid config")) {
+				return;
+			}
+			continue;
+		}
+
+		std::map<config::OutputType, PendingOutput> pending;
+		if (output_cache != NULL) {
+			for (config::OutputType output_type : get_output_types(conf)) {
+				output_cache->begin(get_output_key(conf, output_type),
+						&pending[output_type]);
+			}
+		}
+		ReplyWriter writer = {fd, 0, std::string(), true};
+		bool ok = render_calendar(ctx, [&](config::OutputType output_type,
+					const unsigned char *data, size_t length) {
+			if (output_cache != NULL) {
+				output_cache->append(&pending[output_type], data, length);
+			}
+			return write_reply(&writer, output_type, data, length);
+		});
+		free_render_context(ctx);
+		if (get_render_cache_size(cache) > MAX_RENDER_CACHE_SIZE) {
+			console->info("Clearing render cache");
+			clear_render_cache(cache);
+		}
+		for (auto& entry : pending) {
+			output_cache->commit(&entry.second, ok);
+		}
+		if (!flush_reply(&writer)) {
+			return;
+		}
+		if (ok) {
+			ok = write_chunk(fd, DAEMON_CHUNK_END, NULL, 0);
+		} else {
+			ok = write_error(fd, "Render failed");
+		}
+		if (!ok) {
+			return;
+		}
+	}
+}
+
+bool run_daemon(const std::shared_ptr<spdlog::logger>& console,
+		const std::string& path, OutputCache *output_cache) {
+	struct sockaddr_un addr;
+	memset(&addr, 0, sizeof(addr));
+	addr.sun_family = AF_UNIX;
+	if (path.size() >= sizeof(addr.sun_path)) {
+		console->error("{}: socket path too long", path);
+		return false;
+	}
+	strcpy(addr.sun_path, path.c_str());
+
+	int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+	if (fd < 0) {
+		console->error("socket: {}", strerror(errno));
+		return false;
+	}
+	// Replaces the socket of an earlier daemon, but nothing else.
+	struct stat st;
+	if (lstat(path.c_str(), &st) == 0) {
+		if (!S_ISSOCK(st.st_mode)) {
+			console->error("{}: exists and is not a socket", path);
+			close(fd);
+			return false;
+		}
+		unlink(path.c_str());
+	}
+	if (bind(fd, reinterpret_cast<struct sockaddr*>(&addr),
+				sizeof(addr)) < 0 || listen(fd, 16) < 0) {
+		console->error("{}: {}", path, strerror(errno));
+		close(fd);
+		return false;
+	}
+	console->info("Listening on {}", path);
+	// Cached outputs are copied with sendfile(), which has no MSG_NOSIGNAL.
+	signal(SIGPIPE, SIG_IGN);
+
+	RenderCache *cache = create_render_cache();
+	for (;;) {
+		int client = accept(fd, NULL, NULL);
+		if (client < 0) {
+			if (errno == EINTR || errno == ECONNABORTED) {
+				continue;
+			}
+			console->error("accept: {}", strerror(errno));
+			break;
+		}
+		// So that a client that stops reading or writing does not hold up
+		// the others forever.
+		struct timeval timeout = {DAEMON_IDLE_TIMEOUT, 0};
+		setsockopt(client, SOL_SOCKET, SO_RCVTIMEO, &timeout,
+				sizeof(timeout));
+		setsockopt(client, SOL_SOCKET, SO_SNDTIMEO, &timeout,
+				sizeof(timeout));
+		serve_connection(console, client, cache, output_cache);
+		close(client);
+	}
+	free_render_cache(cache);
+	close(fd);
+	return false;
+}
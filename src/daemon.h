@@ -0,0 +1,38 @@
+#ifndef DAEMON_H
+#define DAEMON_H
+
+#include <spdlog/spdlog.h>
+#include <stdint.h>
+
+#include <memory>
+#include <string>
+
+#include "output_cache.h"
+
+// Protocol of calendar --daemon. Integers are big-endian.
+//
+// A client sends any number of requests on one connection, each a uint32
+// length followed by a CalendarConfig of that many bytes in protobuf wire
+// format. Each reply is a series of chunks: a uint8 kind, a uint32 length
+// and that many bytes. Chunks of kind 0 to 2 carry output of that
+// config::OutputType, in order. The reply ends with a DAEMON_CHUNK_END
+// chunk of length 0, or with a DAEMON_CHUNK_ERROR chunk holding a message,
+// in which case the output sent so far is incomplete.
+const uint8_t DAEMON_CHUNK_ERROR = 0xfe;
+const uint8_t DAEMON_CHUNK_END = 0xff;
+
+// Larger requests are refused and their connection closed.
+const uint32_t DAEMON_MAX_REQUEST_SIZE = 16 << 20;
+
+// Connections are served one at a time, so one that sends nothing, or
+// reads nothing, for this many seconds is closed.
+const int DAEMON_IDLE_TIMEOUT = 10;
+
+// Listens on a Unix domain socket at path, replacing any socket already
+// there, and serves one connection at a time, keeping caches warm across
+// requests. Outputs found in output_cache, if not NULL, are sent from
+// there. Only returns on error.
+bool run_daemon(const std::shared_ptr<spdlog::logger>& console,
+		const std::string& path, OutputCache *output_cache);
+
+#endif	// DAEMON_H
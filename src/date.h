@@ -0,0 +1,80 @@
+#ifndef DATE_H
+#define DATE_H
+
+// Integer civil-date arithmetic on the proleptic Gregorian calendar. Days
+// are counted from 1970-01-01 (day 0), months run from 1 to 12 and weekdays
+// from 0 (Sunday) to 6, as in struct tm. Nothing here depends on the local
+// time zone.
+
+struct Date {
+	int year;
+	int month;
+	int day;
+};
+
+constexpr bool is_leap_year(int year) {
+	return year % 4 == 0 && (year % 100 != 0 || year % 400 == 0);
+}
+
+constexpr int days_in_month(int year, int month) {
+	return month == 2 ? (is_leap_year(year) ? 29 : 28) :
+		(month == 4 || month == 6 || month == 9 || month == 11) ? 30 : 31;
+}
+
+constexpr int days_in_year(int year) {
+	return is_leap_year(year) ? 366 : 365;
+}
+
+// Howard Hinnant's days_from_civil().
+constexpr int days_from_civil(int year, int month, int day) {
+	int y = month <= 2 ? year - 1 : year;
+	int era = (y >= 0 ? y : y - 399) / 400;
+	int yoe = y - era * 400;
+	int doy = (153 * (month > 2 ? month - 3 : month + 9) + 2) / 5 + day - 1;
+	int doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+	return era * 146097 + doe - 719468;
+}
+
+// Howard Hinnant's civil_from_days().
+constexpr Date civil_from_days(int days) {
+	int z = days + 719468;
+	int era = (z >= 0 ? z : z - 146096) / 146097;
+	int doe = z - era * 146097;
+	int yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+	int doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+	int mp = (5 * doy + 2) / 153;
+	int month = mp < 10 ? mp + 3 : mp - 9;
+	return Date{yoe + era * 400 + (month <= 2 ? 1 : 0), month,
+		doy - (153 * mp + 2) / 5 + 1};
+}
+
+constexpr int weekday_from_days(int days) {
+	return days >= -4 ? (days + 4) % 7 : (days + 5) % 7 + 6;
+}
+
+// Zero-based index of the day within its year.
+constexpr int day_of_year(int year, int month, int day) {
+	return days_from_civil(year, month, day) - days_from_civil(year, 1, 1);
+}
+
+// Calls f(date, yday, wday) for every day of the year, in order, where yday
+// is day_of_year().
+template <typename F>
+void for_each_day(int year, F f) {
+	int wday = weekday_from_days(days_from_civil(year, 1, 1));
+	int yday = 0;
+	for (int month = 1; month <= 12; month++) {
+		for (int day = 1; day <= days_in_month(year, month); day++) {
+			f(Date{year, month, day}, yday, wday);
+			yday++;
+			wday = (wday + 1) % 7;
+		}
+	}
+}
+
+static_assert(days_from_civil(1970, 1, 1) == 0, "epoch");
+static_assert(civil_from_days(-1).year == 1969, "day before epoch");
+static_assert(weekday_from_days(0) == 4, "1970-01-01 was a Thursday");
+static_assert(weekday_from_days(-5) == 6, "1969-12-27 was a Saturday");
+
+#endif	// DATE_H
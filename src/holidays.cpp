@@ -1,78 +1,158 @@
 #include "holidays.h"
 #include <stdio.h>
+#include <string.h>
+#include <strings.h>
 
-int is_fixed_holiday(time_t t) {
-	struct tm timeinfo = *localtime(&t);
-
-	// New Year's Day (January 1)
-	if (timeinfo.tm_mon == 0 && timeinfo.tm_mday == 1) {
-		return 1;
-	}
-	// Independence Day (July 4)
-	if (timeinfo.tm_mon == 6 && timeinfo.tm_mday == 4) {
-		return 1;
-	}
-	// Veterans Day (November 11)
-	if (timeinfo.tm_mon == 10 && timeinfo.tm_mday == 11) {
-		return 1;
-	}
-	// December 25 (Christmas)
-	if (timeinfo.tm_mon == 11 && timeinfo.tm_mday == 25) {
-		return 1;
-	}
-	return 0;
+std::vector<HolidayRule> get_us_federal_holiday_rules() {
+	return {
+		// New Year's Day (January 1)
+		{1, 1, 0, 0, true, true},
+		// Birthday of Martin Luther King, Jr. (Third Monday in January)
+		{1, 0, 1, 3, false, false},
+		// Washington's Birthday (Third Monday in February)
+		{2, 0, 1, 3, false, false},
+		// Memorial Day (Last Monday in May)
+		{5, 0, 1, -1, false, false},
+		// Independence Day (July 4)
+		{7, 4, 0, 0, true, true},
+		// Labor Day (First Monday in September)
+		{9, 0, 1, 1, false, false},
+		// Columbus Day (Second Monday in October)
+		{10, 0, 1, 2, false, false},
+		// Veterans Day (November 11)
+		{11, 11, 0, 0, true, true},
+		// Thanksgiving Day (Fourth Thursday in November)
+		{11, 0, 4, 4, false, false},
+		// December 25 (Christmas)
+		{12, 25, 0, 0, true, true},
+	};
 }
 
-int is_last_week(time_t t, struct tm *timeinfo_this_week) {
-	t += SECS_PER_DAY * 7;
-	return timeinfo_this_week->tm_mon + 1 == localtime(&t)->tm_mon;
+HolidayTable::HolidayTable() : HolidayTable(get_us_federal_holiday_rules()) {
 }
 
-int is_holiday(time_t t) {
-	struct tm timeinfo = *localtime(&t);
-	int mweek = (timeinfo.tm_mday - 1) / 7 + 1;
+HolidayTable::HolidayTable(const std::vector<HolidayRule>& rules) {
+	memset(fixed_, 0, sizeof(fixed_));
+	memset(saturday_to_friday_, 0, sizeof(saturday_to_friday_));
+	memset(sunday_to_monday_, 0, sizeof(sunday_to_monday_));
+	memset(nth_week_, 0, sizeof(nth_week_));
+	memset(last_week_, 0, sizeof(last_week_));
 
-	// If today is not a weekend, check if today is a fixed holiday
-	if (0 < timeinfo.tm_wday && timeinfo.tm_wday < 6) {
-		if (is_fixed_holiday(t)) {
-			return 1;
+	for (const HolidayRule& rule : rules) {
+		if (rule.day > 0) {
+			fixed_[rule.month] |= 1u << rule.day;
+			if (rule.saturday_to_friday) {
+				saturday_to_friday_[rule.month] |= 1u << rule.day;
+			}
+			if (rule.sunday_to_monday) {
+				sunday_to_monday_[rule.month] |= 1u << rule.day;
+			}
+		} else if (rule.week < 0) {
+			last_week_[rule.month] |= 1 << rule.wday;
+		} else {
+			nth_week_[rule.month][rule.wday] |= 1 << rule.week;
 		}
 	}
+}
+
+bool HolidayTable::is_holiday(int days) const {
+	Date date = civil_from_days(days);
+	int wday = weekday_from_days(days);
+	uint32_t day_bit = 1u << date.day;
+
+	// A fixed holiday, unless it is observed on another day
+	if ((fixed_[date.month] & day_bit) &&
+			!(wday == 6 && (saturday_to_friday_[date.month] & day_bit)) &&
+			!(wday == 0 && (sunday_to_monday_[date.month] & day_bit))) {
+		return true;
+	}
 	// If today is friday, see if tomorrow is a fixed holiday
-	if (timeinfo.tm_wday == 5 &&
-			is_fixed_holiday(t + SECS_PER_DAY)) {
-		return 1;
+	if (wday == 5) {
+		Date tomorrow = civil_from_days(days + 1);
+		if (saturday_to_friday_[tomorrow.month] & (1u << tomorrow.day)) {
+			return true;
+		}
 	}
 	// If today is monday, see if yesterday was a fixed holiday
-	if (timeinfo.tm_wday == 1 &&
-			is_fixed_holiday(t - SECS_PER_DAY)) {
-		return 1;
+	if (wday == 1) {
+		Date yesterday = civil_from_days(days - 1);
+		if (sunday_to_monday_[yesterday.month] & (1u << yesterday.day)) {
+			return true;
+		}
 	}
 
-	// Birthday of Martin Luther King, Jr. (Third Monday in January)
-	if (timeinfo.tm_mon == 0 && timeinfo.tm_wday == 1 && mweek == 3) {
-		return 1;
-	}
-	// Washington's Birthday (Third Monday in February)
-	if (timeinfo.tm_mon == 1 && timeinfo.tm_wday == 1 && mweek == 3) {
-		return 1;
+	int mweek = (date.day - 1) / 7 + 1;
+	if (nth_week_[date.month][wday] & (1 << mweek)) {
+		return true;
 	}
-	// Memorial Day (Last Monday in May)
-	if (timeinfo.tm_mon == 4 && timeinfo.tm_wday == 1 &&
-			is_last_week(t, &timeinfo)) {
-		return 1;
+	return (last_week_[date.month] & (1 << wday)) &&
+		date.day + 7 > days_in_month(date.year, date.month);
+}
+
+// Sets the bit of the given day if it falls in year.
+void set_day(HolidayMask *mask, int year, int days) {
+	int yday = days - days_from_civil(year, 1, 1);
+	if (0 <= yday && yday < days_in_year(year)) {
+		mask->set(yday);
 	}
-	// Labor Day (First Monday in September)
-	if (timeinfo.tm_mon == 8 && timeinfo.tm_wday == 1 && mweek == 1) {
-		return 1;
+}
+
+HolidayMask HolidayTable::compute_mask(int year) const {
+	HolidayMask mask;
+
+	// A fixed holiday may be observed on the Friday before or the Monday
+	// after, which may fall in the neighboring year.
+	for (int y = year - 1; y <= year + 1; y++) {
+		for (int month = 1; month <= 12; month++) {
+			for (uint32_t bits = fixed_[month]; bits != 0; bits &= bits - 1) {
+				int day = ffs(bits) - 1;
+				if (day > days_in_month(y, month)) {
+					continue;
+				}
+				uint32_t day_bit = 1u << day;
+				int days = days_from_civil(y, month, day);
+				int wday = weekday_from_days(days);
+				if (wday == 6 && (saturday_to_friday_[month] & day_bit)) {
+					days--;
+				} else if (wday == 0 && (sunday_to_monday_[month] & day_bit)) {
+					days++;
+				}
+				set_day(&mask, year, days);
+			}
+		}
 	}
-	// Columbus Day (Second Monday in October)
-	if (timeinfo.tm_mon == 9 && timeinfo.tm_wday == 1 && mweek == 2) {
-		return 1;
+
+	for (int month = 1; month <= 12; month++) {
+		int first = days_from_civil(year, month, 1);
+		int first_wday = weekday_from_days(first);
+		int num_days = days_in_month(year, month);
+		for (int wday = 0; wday < 7; wday++) {
+			// Days after the 1st of the first such weekday
+			int offset = (wday - first_wday + 7) % 7;
+			for (int week = 1; week < 8; week++) {
+				int day = offset + (week - 1) * 7;
+				if ((nth_week_[month][wday] & (1 << week)) && day < num_days) {
+					set_day(&mask, year, first + day);
+				}
+			}
+			if (last_week_[month] & (1 << wday)) {
+				set_day(&mask, year,
+						first + offset + (num_days - 1 - offset) / 7 * 7);
+			}
+		}
 	}
-	// Thanksgiving Day (Fourth Thursday in November)
-	if (timeinfo.tm_mon == 10 && timeinfo.tm_wday == 4 && mweek == 4) {
-		return 1;
+	return mask;
+}
+
+const HolidayMask& HolidayTable::get_mask(int year) {
+	auto it = masks_.find(year);
+	if (it == masks_.end()) {
+		it = masks_.emplace(year, compute_mask(year)).first;
 	}
-	return 0;
+	return it->second;
+}
+
+int is_holiday(int days) {
+	static const HolidayTable us_federal_holidays;
+	return us_federal_holidays.is_holiday(days);
 }
@@ -1,10 +1,60 @@
 #ifndef HOLIDAYS_H
 #define HOLIDAYS_H
 
-#include <time.h>
+#include <bitset>
+#include <stdint.h>
+#include <unordered_map>
+#include <vector>
 
-#define SECS_PER_DAY (60 * 60 * 24)
+#include "date.h"
 
-int is_holiday(time_t t);
+// Bit n is set if day n of the year (0 for January 1) is a holiday.
+typedef std::bitset<366> HolidayMask;
+
+// Either a fixed date (day > 0), or the week-th wday of the month, where
+// week is -1 for the last one.
+struct HolidayRule {
+	int month;
+	int day;
+	int wday;
+	int week;
+	// Where a fixed date falling on a weekend is observed instead.
+	bool saturday_to_friday;
+	bool sunday_to_monday;
+};
+
+std::vector<HolidayRule> get_us_federal_holiday_rules();
+
+// Holiday rules compiled into per-month tables, so that checking a day is a
+// few table lookups. Remembers the mask of each year it has been asked
+// about.
+class HolidayTable {
+public:
+	// US federal holidays.
+	HolidayTable();
+	explicit HolidayTable(const std::vector<HolidayRule>& rules);
+
+	// Takes the number of days since 1970-01-01.
+	bool is_holiday(int days) const;
+
+	// Evaluates each rule once for year, rather than checking every day.
+	HolidayMask compute_mask(int year) const;
+	const HolidayMask& get_mask(int year);
+
+private:
+	// Indexed by month (1-12). Bit n of a day set stands for day n.
+	uint32_t fixed_[13];
+	uint32_t saturday_to_friday_[13];
+	uint32_t sunday_to_monday_[13];
+	// Bit n stands for the n-th week.
+	uint8_t nth_week_[13][7];
+	// Bit n stands for weekday n.
+	uint8_t last_week_[13];
+
+	std::unordered_map<int, HolidayMask> masks_;
+};
+
+// US federal holidays. Takes the number of days since 1970-01-01.
+int is_holiday(int days);
 
 #endif	// HOLIDAYS_H
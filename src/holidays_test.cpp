@@ -1,5 +1,3 @@
-#include <time.h>
-
 #include <cppunit/TestFixture.h>
 #include <cppunit/ui/text/TestRunner.h>
 #include <cppunit/extensions/HelperMacros.h>
@@ -12,6 +10,10 @@ class TestHolidays : public CppUnit::TestFixture
 	CPPUNIT_TEST_SUITE(TestHolidays);
 	CPPUNIT_TEST(test2015);
 	CPPUNIT_TEST(test2016);
+	CPPUNIT_TEST(testObservedInPreviousYear);
+	CPPUNIT_TEST(testHolidayTable);
+	CPPUNIT_TEST(testCustomRules);
+	CPPUNIT_TEST(testMaskMatchesDays);
 	CPPUNIT_TEST_SUITE_END();
 
 protected:
@@ -50,13 +52,74 @@ protected:
 		CPPUNIT_ASSERT(is_holiday(ymd(2016, 12, 26)));
 	}
 
+	void testObservedInPreviousYear() {
+		// January 1, 2022 (New Year's Day), falls on a Saturday.
+		CPPUNIT_ASSERT(!is_holiday(ymd(2022, 1, 1)));
+		// Friday, December 31, 2021, will be treated as a holiday.
+		CPPUNIT_ASSERT(is_holiday(ymd(2021, 12, 31)));
+	}
+
+	void testHolidayTable() {
+		HolidayTable table;
+		for (int year = 2015; year <= 2016; year++) {
+			const HolidayMask& mask = table.get_mask(year);
+			CPPUNIT_ASSERT(&mask == &table.get_mask(year));
+			CPPUNIT_ASSERT_EQUAL((size_t)10, mask.count());
+		}
+		// Independence Day, observed on Friday, July 3.
+		CPPUNIT_ASSERT(table.get_mask(2015).test(day_of_year(2015, 7, 3)));
+	}
+
+	void testCustomRules() {
+		HolidayTable table({
+				// December 26, not moved off weekends
+				{12, 26, 0, 0, false, false},
+				// January 1, moved from Sunday to Monday only
+				{1, 1, 0, 0, false, true},
+				// Last Friday in March
+				{3, 0, 5, -1, false, false},
+				});
+		// Saturday
+		CPPUNIT_ASSERT(table.is_holiday(ymd(2015, 12, 26)));
+		CPPUNIT_ASSERT(!table.is_holiday(ymd(2015, 12, 25)));
+		// Sunday, January 1, 2017, moves to Monday.
+		CPPUNIT_ASSERT(!table.is_holiday(ymd(2017, 1, 1)));
+		CPPUNIT_ASSERT(table.is_holiday(ymd(2017, 1, 2)));
+		// Saturday, January 1, 2022, does not move.
+		CPPUNIT_ASSERT(table.is_holiday(ymd(2022, 1, 1)));
+		CPPUNIT_ASSERT(!table.is_holiday(ymd(2021, 12, 31)));
+		CPPUNIT_ASSERT(table.is_holiday(ymd(2016, 3, 25)));
+		CPPUNIT_ASSERT(!table.is_holiday(ymd(2016, 3, 18)));
+		CPPUNIT_ASSERT(!table.is_holiday(ymd(2016, 7, 4)));
+	}
+
+	void testMaskMatchesDays() {
+		HolidayTable us;
+		HolidayTable custom({
+				// Observed in the previous and next years
+				{1, 1, 0, 0, true, false},
+				{12, 31, 0, 0, false, true},
+				// Only in leap years
+				{2, 29, 0, 0, true, true},
+				// Fifth Friday, in some years only
+				{3, 0, 5, 5, false, false},
+				{12, 0, 0, -1, false, false},
+				});
+		for (HolidayTable* table : {&us, &custom}) {
+			for (int year = 1990; year <= 2030; year++) {
+				HolidayMask mask = table->compute_mask(year);
+				for (int yday = 0; yday < days_in_year(year); yday++) {
+					CPPUNIT_ASSERT_EQUAL(
+							table->is_holiday(ymd(year, 1, 1) + yday),
+							mask.test(yday));
+				}
+			}
+		}
+	}
+
 private:
-	time_t ymd(int year, int month, int day) {
-		struct tm timeinfo = {0};
-		timeinfo.tm_year = year - 1900;
-		timeinfo.tm_mon = month - 1;
-		timeinfo.tm_mday = day;
-		return mktime(&timeinfo);
+	int ymd(int year, int month, int day) {
+		return days_from_civil(year, month, day);
 	}
 };
 CPPUNIT_TEST_SUITE_REGISTRATION(TestHolidays);
@@ -0,0 +1,257 @@
+#include "output_cache.h"
+
+#include <ctype.h>
+#include <dirent.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/io/zero_copy_stream_impl_lite.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/sendfile.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <vector>
+
+#include "calendar.h"
+
+namespace {
+
+const uint64_t FNV_OFFSET_BASIS = 14695981039346656037ULL;
+const uint64_t FNV_PRIME = 1099511628211ULL;
+
+// Part of every output key. Bump it whenever the same config renders
+// differently, so that outputs of older builds are not served.
+const uint32_t OUTPUT_CACHE_VERSION = 2;
+
+uint64_t fnv1a(uint64_t hash, const void *data, size_t length) {
+	const unsigned char *p = static_cast<const unsigned char*>(data);
+	for (size_t i = 0; i < length; i++) {
+		hash = (hash ^ p[i]) * FNV_PRIME;
+	}
+	return hash;
+}
+
+// Cached outputs are named by their key in hex. Anything else in the
+// directory, such as temporary files, is left alone.
+bool is_output_name(const char *name) {
+	size_t length = 0;
+	for (; name[length] != '\0'; length++) {
+		if (!isxdigit(name[length])) {
+			return false;
+		}
+	}
+	return length == 16;
+}
+
+struct CachedFile {
+	std::string path;
+	off_t size;
+	struct timespec mtime;
+};
+
+bool is_older(const CachedFile& a, const CachedFile& b) {
+	if (a.mtime.tv_sec != b.mtime.tv_sec) {
+		return a.mtime.tv_sec < b.mtime.tv_sec;
+	}
+	return a.mtime.tv_nsec < b.mtime.tv_nsec;
+}
+
+// Lists the cached outputs in dir_path and returns their total size.
+uint64_t list_cached_files(const std::string& dir_path,
+		std::vector<CachedFile> *files) {
+	DIR *dir = opendir(dir_path.c_str());
+	if (dir == NULL) {
+		return 0;
+	}
+	uint64_t total = 0;
+	for (struct dirent *entry = readdir(dir); entry != NULL;
+			entry = readdir(dir)) {
+		if (!is_output_name(entry->d_name)) {
+			continue;
+		}
+		CachedFile file;
+		file.path = dir_path + "/" + entry->d_name;
+		struct stat st;
+		if (stat(file.path.c_str(), &st) < 0 || !S_ISREG(st.st_mode)) {
+			continue;
+		}
+		file.size = st.st_size;
+		file.mtime = st.st_mtim;
+		files->push_back(file);
+		total += file.size;
+	}
+	closedir(dir);
+	return total;
+}
+
+}  // namespace
+
+uint64_t get_output_key(const config::CalendarConfig& conf,
+		config::OutputType output_type, Profile *profile) {
+	config::CalendarConfig canonical = conf;
+	canonical.set_start_year(get_start_year(conf, profile));
+	// Only names the output files.
+	canonical.clear_output_name();
+
+	std::string bytes;
+	{
+		google::protobuf::io::StringOutputStream string_stream(&bytes);
+		google::protobuf::io::CodedOutputStream coded_stream(&string_stream);
+		coded_stream.SetSerializationDeterministic(true);
+		canonical.SerializeToCodedStream(&coded_stream);
+	}
+	uint64_t hash = fnv1a(FNV_OFFSET_BASIS, &OUTPUT_CACHE_VERSION,
+			sizeof(OUTPUT_CACHE_VERSION));
+	hash = fnv1a(hash, bytes.data(), bytes.size());
+	int32_t type = output_type;
+	return fnv1a(hash, &type, sizeof(type));
+}
+
+OutputCache::OutputCache(const std::string& dir, uint64_t max_bytes)
+	: dir_(dir), max_bytes_(max_bytes) {
+	mkdir(dir_.c_str(), 0777);
+	std::lock_guard<std::mutex> lock(mutex_);
+	std::vector<CachedFile> files;
+	total_bytes_ = list_cached_files(dir_, &files);
+	if (total_bytes_ > max_bytes_) {
+		evict();
+	}
+}
+
+std::string OutputCache::get_path(uint64_t key) const {
+	char name[17];
+	snprintf(name, sizeof(name), "%016" PRIx64, key);
+	return dir_ + "/" + name;
+}
+
+int OutputCache::open(uint64_t key, off_t *size) {
+	int fd = ::open(get_path(key).c_str(), O_RDONLY);
+	if (fd < 0) {
+		return -1;
+	}
+	struct stat st;
+	if (fstat(fd, &st) < 0) {
+		close(fd);
+		return -1;
+	}
+	// Marks the file as just used.
+	futimens(fd, NULL);
+	*size = st.st_size;
+	return fd;
+}
+
+bool OutputCache::begin(uint64_t key, PendingOutput *output) {
+	output->key = key;
+	output->temp_path = dir_ + "/tmp-XXXXXX";
+	output->fd = mkstemp(&output->temp_path[0]);
+	output->ok = output->fd >= 0;
+	return output->ok;
+}
+
+void OutputCache::append(PendingOutput *output, const unsigned char *data,
+		size_t length) {
+	while (output->ok && length > 0) {
+		ssize_t n = write(output->fd, data, length);
+		if (n < 0 && errno == EINTR) {
+			continue;
+		}
+		if (n < 0) {
+			output->ok = false;
+			break;
+		}
+		data += n;
+		length -= n;
+	}
+}
+
+bool OutputCache::commit(PendingOutput *output, bool keep) {
+	if (output->fd < 0) {
+		return false;
+	}
+	struct stat st;
+	bool ok = fstat(output->fd, &st) == 0;
+	ok = close(output->fd) == 0 && ok && output->ok && keep;
+	output->fd = -1;
+	if (ok) {
+		std::lock_guard<std::mutex> lock(mutex_);
+		std::string path = get_path(output->key);
+		// An output may replace one of the same key written meanwhile.
+		struct stat old_st;
+		if (stat(path.c_str(), &old_st) == 0) {
+			total_bytes_ -= std::min<uint64_t>(total_bytes_, old_st.st_size);
+		}
+		ok = rename(output->temp_path.c_str(), path.c_str()) == 0;
+		if (ok) {
+			total_bytes_ += st.st_size;
+			if (total_bytes_ > max_bytes_) {
+				evict();
+			}
+		}
+	}
+	if (!ok) {
+		unlink(output->temp_path.c_str());
+		return false;
+	}
+	return true;
+}
+
+void OutputCache::evict() {
+	// Also picks up what other processes sharing dir_ added or removed.
+	std::vector<CachedFile> files;
+	total_bytes_ = list_cached_files(dir_, &files);
+
+	// Goes below max_bytes_, so that the next outputs do not each scan the
+	// directory again.
+	uint64_t target = max_bytes_ - max_bytes_ / 8;
+	std::sort(files.begin(), files.end(), is_older);
+	for (size_t i = 0; i < files.size() && total_bytes_ > target; i++) {
+		if (unlink(files[i].path.c_str()) == 0) {
+			total_bytes_ -= files[i].size;
+		}
+	}
+}
+
+bool copy_fd(int out_fd, int in_fd, off_t length) {
+	off_t offset = 0;
+	while (offset < length) {
+		ssize_t n = sendfile(out_fd, in_fd, &offset, length - offset);
+		if (n < 0 && errno == EINTR) {
+			continue;
+		}
+		if (n < 0 && (errno == EINVAL || errno == ENOSYS)) {
+			break;
+		}
+		if (n <= 0) {
+			return false;
+		}
+	}
+
+	// sendfile() cannot copy between these descriptors.
+	char buf[64 << 10];
+	while (offset < length) {
+		ssize_t n = pread(in_fd, buf,
+				std::min<off_t>(sizeof(buf), length - offset), offset);
+		if (n < 0 && errno == EINTR) {
+			continue;
+		}
+		if (n <= 0) {
+			return false;
+		}
+		for (ssize_t written = 0; written < n; ) {
+			ssize_t m = write(out_fd, buf + written, n - written);
+			if (m < 0 && errno == EINTR) {
+				continue;
+			}
+			if (m < 0) {
+				return false;
+			}
+			written += m;
+		}
+		offset += n;
+	}
+	return true;
+}
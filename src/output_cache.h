@@ -0,0 +1,68 @@
+#ifndef OUTPUT_CACHE_H
+#define OUTPUT_CACHE_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <sys/types.h>
+
+#include <mutex>
+#include <string>
+
+#include "config.pb.h"
+
+class Profile;
+
+// FNV-1a hash of the cache format version, of conf, serialized
+// deterministically with its start year filled in and its output name
+// cleared, and of the output type. Filling in the start year is counted in
+// profile, if not NULL.
+uint64_t get_output_key(const config::CalendarConfig& conf,
+		config::OutputType output_type, Profile *profile = NULL);
+
+// An output being written into the cache.
+struct PendingOutput {
+	uint64_t key;
+	std::string temp_path;
+	int fd;
+	// Cleared if a write failed, so the output is not kept.
+	bool ok;
+};
+
+// Rendered outputs kept in a directory, one file per output key. A file's
+// modification time is when it was last used. Once the directory grows
+// past max_bytes, the least recently used files are removed until it is
+// an eighth below that. Its size is kept in memory in between, so the
+// directory is only listed on creation and when evicting.
+class OutputCache {
+public:
+	OutputCache(const std::string& dir, uint64_t max_bytes);
+
+	// Opens the output for key and marks it as used. Returns -1 if it is
+	// not cached.
+	int open(uint64_t key, off_t *size);
+
+	// Starts a new output for key in a temporary file.
+	bool begin(uint64_t key, PendingOutput *output);
+	void append(PendingOutput *output, const unsigned char *data,
+			size_t length);
+	// Keeps the output if every write succeeded. Discards it if not, or if
+	// keep is false.
+	bool commit(PendingOutput *output, bool keep);
+
+private:
+	std::string get_path(uint64_t key) const;
+	// Called with mutex_ held.
+	void evict();
+
+	std::string dir_;
+	uint64_t max_bytes_;
+	// Bytes of the cached outputs, as far as this process knows.
+	uint64_t total_bytes_;
+	// Guards total_bytes_, and serializes eviction between threads.
+	std::mutex mutex_;
+};
+
+// Copies length bytes from in_fd to out_fd, with sendfile() where it can.
+bool copy_fd(int out_fd, int in_fd, off_t length);
+
+#endif	// OUTPUT_CACHE_H
@@ -0,0 +1,187 @@
+#include "profile.h"
+
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+
+namespace {
+
+const char *counter_names[NUM_COUNTERS] = {
+	"layouts_created", "layouts_shown", "texts_shaped", "glyphs_shaped",
+	"glyph_runs_shown", "svgs_parsed", "svgs_rendered", "path_ops", "fills",
+	"strokes", "paints", "masks", "localtime_calls", "bytes_written"};
+
+thread_local const char *current_phase = "other";
+
+// Counts made on this thread in current_phase, not yet added to profile.
+struct PendingCounts {
+	Profile *profile = NULL;
+	const char *phase = NULL;
+	long counters[NUM_COUNTERS] = {};
+
+	~PendingCounts() {
+		flush();
+	}
+
+	void flush() {
+		if (profile != NULL) {
+			profile->add_counts(phase, counters);
+			profile = NULL;
+			std::fill(counters, counters + NUM_COUNTERS, 0);
+		}
+	}
+};
+
+thread_local PendingCounts pending_counts;
+
+// Small thread numbers read better in a trace viewer than thread ids.
+std::atomic<int> next_tid(1);
+thread_local int tid = next_tid++;
+
+}  // namespace
+
+Profile::PhaseTime& Profile::get_phase(const std::string& phase) {
+	auto it = index_.find(phase);
+	if (it == index_.end()) {
+		it = index_.emplace(phase, phases_.size()).first;
+		phases_.push_back(PhaseTime{phase, 0, 0, 0, 0, {}});
+	}
+	return phases_[it->second];
+}
+
+Profile::Profile(bool tracing)
+	: tracing_(tracing), epoch_(Clock::now()) {
+}
+
+Profile::~Profile() {
+	if (pending_counts.profile == this) {
+		pending_counts.profile = NULL;
+	}
+}
+
+void Profile::add(const char *phase, Clock::time_point start,
+		Clock::time_point end) {
+	double seconds = std::chrono::duration<double>(end - start).count();
+	std::lock_guard<std::mutex> lock(mutex_);
+	if (tracing_) {
+		spans_.push_back(Span{phase, start, end, tid});
+	}
+	PhaseTime& time = get_phase(phase);
+	if (time.count == 0) {
+		time.min = seconds;
+		time.max = seconds;
+	}
+	time.count++;
+	time.total += seconds;
+	time.min = std::min(time.min, seconds);
+	time.max = std::max(time.max, seconds);
+}
+
+void Profile::count(Counter counter, long n) {
+	if (pending_counts.profile != this ||
+			pending_counts.phase != current_phase) {
+		pending_counts.flush();
+		pending_counts.profile = this;
+		pending_counts.phase = current_phase;
+	}
+	pending_counts.counters[counter] += n;
+}
+
+void Profile::add_counts(const char *phase, const long *counters) {
+	std::lock_guard<std::mutex> lock(mutex_);
+	PhaseTime& time = get_phase(phase);
+	for (int i = 0; i < NUM_COUNTERS; i++) {
+		time.counters[i] += counters[i];
+	}
+}
+
+void Profile::log(const std::shared_ptr<spdlog::logger>& console) const {
+	if (pending_counts.profile == this) {
+		pending_counts.flush();
+	}
+	std::lock_guard<std::mutex> lock(mutex_);
+	for (const PhaseTime& time : phases_) {
+		console->info("{:<16} {:>6} x {:>10.3f} ms total, "
+				"{:.3f} / {:.3f} / {:.3f} ms min / mean / max",
+				time.name, time.count, time.total * 1e3, time.min * 1e3,
+				time.count > 0 ? time.total / time.count * 1e3 : 0,
+				time.max * 1e3);
+		std::string counters;
+		for (int i = 0; i < NUM_COUNTERS; i++) {
+			if (time.counters[i] != 0) {
+				counters += fmt::format(" {}={}", counter_names[i],
+						time.counters[i]);
+			}
+		}
+		if (!counters.empty()) {
+			console->info("{:<16}{}", "", counters);
+		}
+	}
+}
+
+std::string Profile::to_json() const {
+	if (pending_counts.profile == this) {
+		pending_counts.flush();
+	}
+	std::lock_guard<std::mutex> lock(mutex_);
+	// Phase names are identifiers, so they need no escaping.
+	std::string json = "{\"phases\":[";
+	for (size_t i = 0; i < phases_.size(); i++) {
+		const PhaseTime& time = phases_[i];
+		json += fmt::format("{}{{\"name\":\"{}\",\"count\":{},"
+				"\"total_ms\":{:.6f},\"min_ms\":{:.6f},\"max_ms\":{:.6f},"
+				"\"counters\":{{",
+				i > 0 ? "," : "", time.name, time.count, time.total * 1e3,
+				time.min * 1e3, time.max * 1e3);
+		for (int j = 0; j < NUM_COUNTERS; j++) {
+			json += fmt::format("{}\"{}\":{}", j > 0 ? "," : "",
+					counter_names[j], time.counters[j]);
+		}
+		json += "}}";
+	}
+	json += "]}";
+	return json;
+}
+
+std::string Profile::to_trace_json() const {
+	std::lock_guard<std::mutex> lock(mutex_);
+	int pid = getpid();
+	std::string json = "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+	for (size_t i = 0; i < spans_.size(); i++) {
+		const Span& span = spans_[i];
+		std::chrono::duration<double, std::micro> ts = span.start - epoch_;
+		std::chrono::duration<double, std::micro> dur = span.end - span.start;
+		json += fmt::format("{}{{\"name\":\"{}\",\"ph\":\"X\","
+				"\"ts\":{:.3f},\"dur\":{:.3f},\"pid\":{},\"tid\":{}}}",
+				i > 0 ? ",\n" : "\n", span.name, ts.count(), dur.count(),
+				pid, span.tid);
+	}
+	json += "\n]}\n";
+	return json;
+}
+
+const char* get_current_phase() {
+	return current_phase;
+}
+
+void set_current_phase(const char *phase) {
+	pending_counts.flush();
+	current_phase = phase;
+}
+
+ScopedTimer::ScopedTimer(Profile *profile, const char *phase)
+	: profile_(profile), phase_(phase) {
+	if (profile_ != NULL) {
+		previous_phase_ = get_current_phase();
+		set_current_phase(phase_);
+		start_ = Profile::Clock::now();
+	}
+}
+
+ScopedTimer::~ScopedTimer() {
+	if (profile_ != NULL) {
+		profile_->add(phase_, start_, Profile::Clock::now());
+		set_current_phase(previous_phase_);
+	}
+}
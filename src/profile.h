@@ -0,0 +1,105 @@
+#ifndef PROFILE_H
+#define PROFILE_H
+
+#include <spdlog/spdlog.h>
+
+#include <chrono>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// What a render does, counted per phase.
+enum Counter {
+	COUNTER_LAYOUTS_CREATED,
+	COUNTER_LAYOUTS_SHOWN,
+	COUNTER_TEXTS_SHAPED,
+	COUNTER_GLYPHS_SHAPED,
+	COUNTER_GLYPH_RUNS_SHOWN,
+	COUNTER_SVGS_PARSED,
+	COUNTER_SVGS_RENDERED,
+	COUNTER_PATH_OPS,
+	COUNTER_FILLS,
+	COUNTER_STROKES,
+	COUNTER_PAINTS,
+	COUNTER_MASKS,
+	COUNTER_LOCALTIME_CALLS,
+	COUNTER_BYTES_WRITTEN,
+	NUM_COUNTERS
+};
+
+// Time spent in each phase of one or more renders, and the operations
+// counted in it. Phases can be timed from several threads at once. With
+// tracing, every timed span is also kept for a Chrome trace.
+class Profile {
+public:
+	typedef std::chrono::steady_clock Clock;
+
+	explicit Profile(bool tracing = false);
+	~Profile();
+
+	void add(const char *phase, Clock::time_point start,
+			Clock::time_point end);
+	// Adds n to counter of the phase timed on this thread, or of "other"
+	// if none is. Counts are kept by the thread without locking, and added
+	// to the profile when its phase changes or it exits.
+	void count(Counter counter, long n);
+	void add_counts(const char *phase, const long *counters);
+
+	// One line per phase, in the order they were first timed.
+	void log(const std::shared_ptr<spdlog::logger>& console) const;
+	std::string to_json() const;
+	// The spans in the Trace Event Format, as complete ("X") events.
+	std::string to_trace_json() const;
+
+private:
+	struct PhaseTime {
+		std::string name;
+		int count;
+		double total;
+		double min;
+		double max;
+		long counters[NUM_COUNTERS];
+	};
+
+	struct Span {
+		const char *name;
+		Clock::time_point start;
+		Clock::time_point end;
+		int tid;
+	};
+
+	PhaseTime& get_phase(const std::string& phase);
+
+	bool tracing_;
+	Clock::time_point epoch_;
+	std::vector<Span> spans_;
+
+	std::vector<PhaseTime> phases_;
+	// Index into phases_ by name.
+	std::map<std::string, size_t> index_;
+	mutable std::mutex mutex_;
+};
+
+// The phase whose operations are counted on this thread. Phases must be
+// string literals.
+const char* get_current_phase();
+void set_current_phase(const char *phase);
+
+// Adds the time from its construction to its destruction to a phase of
+// profile, and counts operations on this thread in that phase meanwhile.
+// Does nothing if profile is NULL.
+class ScopedTimer {
+public:
+	ScopedTimer(Profile *profile, const char *phase);
+	~ScopedTimer();
+
+private:
+	Profile *profile_;
+	const char *phase_;
+	const char *previous_phase_;
+	Profile::Clock::time_point start_;
+};
+
+#endif	// PROFILE_H
@@ -0,0 +1,71 @@
+#include "special_days.h"
+
+#include <algorithm>
+
+namespace {
+
+int get_month_day_key(int month, int day) {
+	return month * 32 + day;
+}
+
+int get_last_digit(int year) {
+	return (year % 10 + 10) % 10;
+}
+
+}  // namespace
+
+bool is_every_tenth_year(int first_year, int year) {
+	return (year - first_year) % 10 == 0;
+}
+
+SpecialDayIndex::SpecialDayIndex(const config::CalendarConfig& conf) {
+	for (int i = 0; i < conf.special_day_size(); i++) {
+		const config::SpecialDay& d = conf.special_day(i);
+		int key = get_month_day_key(d.month(), d.day());
+		auto it = buckets_.find(key);
+		if (it == buckets_.end()) {
+			Bucket bucket;
+			bucket.first = -1;
+			for (int& index : bucket.tenth_year) {
+				index = -1;
+			}
+			it = buckets_.emplace(key, bucket).first;
+		}
+		Bucket& bucket = it->second;
+
+		if (d.has_year()) {
+			auto dated = bucket.dated.emplace(d.year(),
+					std::make_pair(i, -1)).first;
+			if (d.has_first_year() &&
+					is_every_tenth_year(d.first_year(), d.year())) {
+				dated->second.second = i;
+			}
+		} else {
+			if (bucket.first < 0) {
+				bucket.first = i;
+			}
+			if (d.has_first_year()) {
+				bucket.tenth_year[get_last_digit(d.first_year())] = i;
+			}
+		}
+	}
+}
+
+int SpecialDayIndex::find(const Date& date) const {
+	auto it = buckets_.find(get_month_day_key(date.month, date.day));
+	if (it == buckets_.end()) {
+		return -1;
+	}
+	const Bucket& bucket = it->second;
+
+	int first = bucket.first;
+	int tenth_year = bucket.tenth_year[get_last_digit(date.year)];
+	auto dated = bucket.dated.find(date.year);
+	if (dated != bucket.dated.end()) {
+		if (first < 0 || dated->second.first < first) {
+			first = dated->second.first;
+		}
+		tenth_year = std::max(tenth_year, dated->second.second);
+	}
+	return tenth_year >= 0 ? tenth_year : first;
+}
@@ -0,0 +1,40 @@
+#ifndef SPECIAL_DAYS_H
+#define SPECIAL_DAYS_H
+
+#include <unordered_map>
+#include <utility>
+
+#include "date.h"
+#include "config.pb.h"
+
+bool is_every_tenth_year(int first_year, int year);
+
+// The special days of a config indexed by (month, day), so that finding the
+// one of a date does not scan them all.
+class SpecialDayIndex {
+public:
+	SpecialDayIndex() {}
+	explicit SpecialDayIndex(const config::CalendarConfig& conf);
+
+	// Index into conf.special_day() of the first special day of the date,
+	// unless a later one is on an every-tenth year, in which case the last
+	// such one. -1 if there is none.
+	int find(const Date& date) const;
+
+private:
+	// Indices of the special days on one (month, day).
+	struct Bucket {
+		// The first one without a year.
+		int first;
+		// The last one without a year whose first_year ends in each digit.
+		int tenth_year[10];
+		// By year: the first one of that year, and the last one of that year
+		// on an every-tenth year.
+		std::unordered_map<int, std::pair<int, int>> dated;
+	};
+
+	// Keyed by month * 32 + day.
+	std::unordered_map<int, Bucket> buckets_;
+};
+
+#endif	// SPECIAL_DAYS_H
@@ -0,0 +1,130 @@
+#include <cppunit/TestFixture.h>
+#include <cppunit/ui/text/TestRunner.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include <cppunit/extensions/TestFactoryRegistry.h>
+
+#include <random>
+
+#include "special_days.h"
+
+class TestSpecialDays : public CppUnit::TestFixture
+{
+	CPPUNIT_TEST_SUITE(TestSpecialDays);
+	CPPUNIT_TEST(testDatedBeatsUndated);
+	CPPUNIT_TEST(testLastTenthYearWins);
+	CPPUNIT_TEST(testFirstYear);
+	CPPUNIT_TEST(testRandomConfigs);
+	CPPUNIT_TEST_SUITE_END();
+
+protected:
+	void testDatedBeatsUndated() {
+		config::CalendarConfig conf;
+		add(&conf, 7, 4, -1, -1);
+		add(&conf, 7, 4, 2016, -1);
+		// Being dated does not win by itself; the first match does.
+		check(conf, {2016, 7, 4}, 0);
+		check(conf, {2017, 7, 4}, 0);
+
+		conf.Clear();
+		add(&conf, 7, 4, 2016, -1);
+		add(&conf, 7, 4, -1, -1);
+		check(conf, {2016, 7, 4}, 0);
+		check(conf, {2017, 7, 4}, 1);
+		check(conf, {2017, 7, 5}, -1);
+	}
+
+	void testLastTenthYearWins() {
+		config::CalendarConfig conf;
+		add(&conf, 3, 1, -1, -1);
+		add(&conf, 3, 1, -1, 1990);
+		add(&conf, 3, 1, 2020, 2000);
+		add(&conf, 3, 1, -1, 2010);
+		add(&conf, 3, 1, -1, 1995);
+		check(conf, {2020, 3, 1}, 3);
+		check(conf, {2030, 3, 1}, 3);
+		check(conf, {2025, 3, 1}, 4);
+		check(conf, {2021, 3, 1}, 0);
+	}
+
+	void testFirstYear() {
+		config::CalendarConfig conf;
+		add(&conf, 12, 24, -1, -1);
+		add(&conf, 12, 24, -1, 2030);
+		add(&conf, 12, 24, 2011, 2031);
+		check(conf, {2040, 12, 24}, 1);
+		// A first_year after the year still counts every ten years back.
+		check(conf, {2020, 12, 24}, 1);
+		check(conf, {2011, 12, 24}, 2);
+		check(conf, {-10, 12, 24}, 1);
+		check(conf, {-9, 12, 24}, 0);
+	}
+
+	// Compares with scanning every special day, over random configs.
+	void testRandomConfigs() {
+		std::mt19937 random(1);
+		for (int n = 0; n < 200; n++) {
+			config::CalendarConfig conf;
+			int num_special_days = random() % 20;
+			for (int i = 0; i < num_special_days; i++) {
+				add(&conf, 1 + random() % 2, 1 + random() % 2,
+						random() % 2 ? -1 : 2000 + random() % 20,
+						random() % 2 ? -1 : 1980 + random() % 60);
+			}
+			SpecialDayIndex index(conf);
+			for (int year = 1990; year < 2030; year++) {
+				for (int month = 1; month <= 2; month++) {
+					for (int day = 1; day <= 3; day++) {
+						Date date = {year, month, day};
+						CPPUNIT_ASSERT_EQUAL(scan(conf, date), index.find(date));
+					}
+				}
+			}
+		}
+	}
+
+private:
+	void add(config::CalendarConfig *conf, int month, int day, int year,
+			int first_year) {
+		config::SpecialDay *d = conf->add_special_day();
+		d->set_month(month);
+		d->set_day(day);
+		if (year >= 0) {
+			d->set_year(year);
+		}
+		if (first_year >= 0) {
+			d->set_first_year(first_year);
+		}
+	}
+
+	void check(const config::CalendarConfig& conf, const Date& date,
+			int expected) {
+		CPPUNIT_ASSERT_EQUAL(expected, scan(conf, date));
+		CPPUNIT_ASSERT_EQUAL(expected, SpecialDayIndex(conf).find(date));
+	}
+
+	// What the renderer did before the index.
+	int scan(const config::CalendarConfig& conf, const Date& date) {
+		int special_day = -1;
+		for (int i = 0; i < conf.special_day_size(); i++) {
+			const config::SpecialDay& d = conf.special_day(i);
+			if (date.month == d.month() &&
+					date.day == d.day() &&
+					(!d.has_year() || date.year == d.year())) {
+				if (special_day < 0 ||
+						(d.has_first_year() &&
+						 is_every_tenth_year(d.first_year(), date.year))) {
+					special_day = i;
+				}
+			}
+		}
+		return special_day;
+	}
+};
+CPPUNIT_TEST_SUITE_REGISTRATION(TestSpecialDays);
+
+int main(int argc, char* argv[])
+{
+	CppUnit::TextUi::TestRunner runner;
+	runner.addTest(CppUnit::TestFactoryRegistry::getRegistry().makeTest());
+	return !runner.run();
+}
@@ -0,0 +1,182 @@
+#include "svg_defs.h"
+
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <map>
+#include <vector>
+
+namespace {
+
+// A <path .../> element, with its path data moved to start at the origin.
+struct PathElement {
+	size_t begin;
+	size_t end;
+	// Every attribute but d and transform, as written.
+	std::string attributes;
+	std::string transform;
+	std::string d;
+	double x;
+	double y;
+};
+
+std::string format_number(double value) {
+	char buf[32];
+	snprintf(buf, sizeof(buf), "%.6f", value);
+	std::string s = buf;
+	s.erase(s.find_last_not_of('0') + 1);
+	if (s.back() == '.') {
+		s.pop_back();
+	}
+	if (s == "-0") {
+		s = "0";
+	}
+	return s;
+}
+
+// Moves path data made of M, L, C and Z commands, as cairo writes them,
+// so that its first point is at the origin.
+bool translate_path_data(const std::string& d, std::string *moved,
+		double *x, double *y) {
+	int num_values = 0;
+	const char *p = d.c_str();
+	while (*p != '\0') {
+		if (isspace(*p)) {
+			p++;
+		} else if (*p == 'M' || *p == 'L' || *p == 'C' || *p == 'Z') {
+			if (num_values % 2 != 0) {
+				return false;
+			}
+			*moved += *p++;
+			*moved += ' ';
+		} else {
+			char *end;
+			double value = strtod(p, &end);
+			if (end == p) {
+				return false;
+			}
+			p = end;
+			if (num_values == 0) {
+				*x = value;
+			} else if (num_values == 1) {
+				*y = value;
+			}
+			value -= num_values % 2 == 0 ? *x : *y;
+			*moved += format_number(value);
+			*moved += ' ';
+			num_values++;
+		}
+	}
+	return num_values >= 2 && num_values % 2 == 0;
+}
+
+// Parses the element svg[begin, end) if it is a path that draws the same
+// wherever it is moved: one without an id, and without references to
+// gradients, patterns, clips or masks, whose user space would not move
+// with it. Depending on its version, cairo writes the style either as a
+// style attribute or as presentation attributes.
+bool parse_path(const std::string& svg, size_t begin, size_t end,
+		PathElement *path) {
+	path->begin = begin;
+	path->end = end;
+	std::string d;
+	size_t pos = begin + 5;
+	while (true) {
+		pos = svg.find_first_not_of(" \t\n", pos);
+		if (pos >= end - 2) {
+			break;
+		}
+		size_t eq = svg.find('=', pos);
+		if (eq >= end || svg[eq + 1] != '"') {
+			return false;
+		}
+		size_t close = svg.find('"', eq + 2);
+		if (close >= end) {
+			return false;
+		}
+		std::string name = svg.substr(pos, eq - pos);
+		std::string value = svg.substr(eq + 2, close - eq - 2);
+		if (name == "d") {
+			d = value;
+		} else if (name == "transform") {
+			path->transform = value;
+		} else if (name == "id" || value.find("url(") != std::string::npos) {
+			return false;
+		} else {
+			path->attributes += " " + svg.substr(pos, close + 1 - pos);
+		}
+		pos = close + 1;
+	}
+	return translate_path_data(d, &path->d, &path->x, &path->y);
+}
+
+}  // namespace
+
+std::string share_svg_paths(const std::string& svg) {
+	std::vector<PathElement> paths;
+	// Number of times each shape is drawn, by attributes and path data.
+	std::map<std::pair<std::string, std::string>, int> counts;
+	for (size_t pos = svg.find("<path "); pos != std::string::npos;
+			pos = svg.find("<path ", pos)) {
+		size_t end = svg.find('>', pos);
+		if (end == std::string::npos) {
+			break;
+		}
+		end++;
+		PathElement path;
+		if (svg[end - 2] == '/' && parse_path(svg, pos, end, &path)) {
+			counts[std::make_pair(path.attributes, path.d)]++;
+			paths.push_back(path);
+		}
+		pos = end;
+	}
+
+	size_t svg_start = svg.find("<svg");
+	size_t svg_end = svg_start == std::string::npos ?
+		std::string::npos : svg.find('>', svg_start);
+	if (svg_end == std::string::npos) {
+		return svg;
+	}
+	svg_end++;
+
+	std::string defs;
+	std::map<std::pair<std::string, std::string>, int> ids;
+	std::string body;
+	size_t copied = svg_end;
+	for (const PathElement& path : paths) {
+		auto key = std::make_pair(path.attributes, path.d);
+		if (counts[key] < 2) {
+			continue;
+		}
+		auto it = ids.find(key);
+		if (it == ids.end()) {
+			it = ids.emplace(key, ids.size()).first;
+			defs += "<path id=\"shape" + std::to_string(it->second) + "\"" +
+				path.attributes + " d=\"" + path.d + "\"/>\n";
+		}
+		body.append(svg, copied, path.begin - copied);
+		body += "<use xlink:href=\"#shape" + std::to_string(it->second) + "\"";
+		if (path.x != 0) {
+			body += " x=\"" + format_number(path.x) + "\"";
+		}
+		if (path.y != 0) {
+			body += " y=\"" + format_number(path.y) + "\"";
+		}
+		if (!path.transform.empty()) {
+			body += " transform=\"" + path.transform + "\"";
+		}
+		body += "/>";
+		copied = path.end;
+	}
+	if (defs.empty()) {
+		return svg;
+	}
+	body.append(svg, copied, std::string::npos);
+	std::string head = svg.substr(0, svg_end);
+	if (head.find("xmlns:xlink=", svg_start) == std::string::npos) {
+		head.insert(svg_end - 1,
+				" xmlns:xlink=\"http://www.w3.org/1999/xlink\"");
+	}
+	return head + "\n<defs>\n" + defs + "</defs>" + body;
+}
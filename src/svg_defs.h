@@ -0,0 +1,11 @@
+#ifndef SVG_DEFS_H
+#define SVG_DEFS_H
+
+#include <string>
+
+// Rewrites an SVG document written by cairo so that each path drawn more
+// than once, with the same style and the same shape up to a translation,
+// is defined once in <defs> and drawn with <use x="" y="">.
+std::string share_svg_paths(const std::string& svg);
+
+#endif	// SVG_DEFS_H
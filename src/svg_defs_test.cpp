@@ -0,0 +1,206 @@
+#include <cairo.h>
+#include <cairo-svg.h>
+#include <cppunit/TestFixture.h>
+#include <cppunit/ui/text/TestRunner.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include <cppunit/extensions/TestFactoryRegistry.h>
+
+#include <math.h>
+
+#include <string>
+
+#include "svg_defs.h"
+
+class TestSvgDefs : public CppUnit::TestFixture
+{
+	CPPUNIT_TEST_SUITE(TestSvgDefs);
+	CPPUNIT_TEST(testSharedPaths);
+	CPPUNIT_TEST(testUniquePathsKept);
+	CPPUNIT_TEST(testTransform);
+	CPPUNIT_TEST(testUnknownPathsKept);
+	CPPUNIT_TEST(testPresentationAttributes);
+	CPPUNIT_TEST(testReferencesKept);
+	CPPUNIT_TEST(testXlinkDeclared);
+	CPPUNIT_TEST(testCairoOutput);
+	CPPUNIT_TEST_SUITE_END();
+
+protected:
+	void testSharedPaths() {
+		std::string svg = document(
+				"<path style=\"fill:red;\" d=\"M 10 20 L 11 20.5 Z M 10 20 \"/>\n"
+				"<path style=\"fill:red;\" d=\"M 30 40 L 31 40.5 Z M 30 40 \"/>\n"
+				"<path style=\"fill:blue;\" d=\"M 30 40 L 31 40.5 Z \"/>\n");
+		CPPUNIT_ASSERT_EQUAL(document(
+				"\n<defs>\n"
+				"<path id=\"shape0\" style=\"fill:red;\" "
+				"d=\"M 0 0 L 1 0.5 Z M 0 0 \"/>\n"
+				"</defs>",
+				"<use xlink:href=\"#shape0\" x=\"10\" y=\"20\"/>\n"
+				"<use xlink:href=\"#shape0\" x=\"30\" y=\"40\"/>\n"
+				"<path style=\"fill:blue;\" d=\"M 30 40 L 31 40.5 Z \"/>\n"),
+				share_svg_paths(svg));
+	}
+
+	void testUniquePathsKept() {
+		std::string svg = document(
+				"<path style=\"fill:red;\" d=\"M 10 20 L 11 20 Z \"/>\n"
+				"<path style=\"fill:red;\" d=\"M 30 40 L 32 40 Z \"/>\n");
+		CPPUNIT_ASSERT_EQUAL(svg, share_svg_paths(svg));
+	}
+
+	void testTransform() {
+		std::string svg = document(
+				"<path d=\"M 0 0 C 1 1 2 -1 3 0 \" transform=\"scale(2)\"/>\n"
+				"<path d=\"M -1.5 0 C -0.5 1 0.5 -1 1.5 0 \"/>\n");
+		CPPUNIT_ASSERT_EQUAL(document(
+				"\n<defs>\n"
+				"<path id=\"shape0\" d=\"M 0 0 C 1 1 2 -1 3 0 \"/>\n"
+				"</defs>",
+				"<use xlink:href=\"#shape0\" transform=\"scale(2)\"/>\n"
+				"<use xlink:href=\"#shape0\" x=\"-1.5\"/>\n"),
+				share_svg_paths(svg));
+	}
+
+	void testUnknownPathsKept() {
+		// Other attributes or path commands are left alone.
+		std::string svg = document(
+				"<path id=\"a\" d=\"M 1 1 L 2 2 \"/>\n"
+				"<path id=\"b\" d=\"M 1 1 L 2 2 \"/>\n"
+				"<path d=\"M 1 1 H 2 \"/>\n"
+				"<path d=\"M 1 1 H 2 \"/>\n"
+				"<path d=\"\"/>\n"
+				"<path d=\"\"/>\n");
+		CPPUNIT_ASSERT_EQUAL(svg, share_svg_paths(svg));
+	}
+
+	void testPresentationAttributes() {
+		std::string svg = document(
+				"<path fill-rule=\"nonzero\" fill=\"rgb(0%, 0%, 0%)\" "
+				"d=\"M 1 2 L 3 4 Z \"/>\n"
+				"<path fill-rule=\"nonzero\" fill=\"rgb(0%, 0%, 0%)\" "
+				"d=\"M 5 2 L 7 4 Z \"/>\n");
+		CPPUNIT_ASSERT_EQUAL(document(
+				"\n<defs>\n"
+				"<path id=\"shape0\" fill-rule=\"nonzero\" "
+				"fill=\"rgb(0%, 0%, 0%)\" d=\"M 0 0 L 2 2 Z \"/>\n"
+				"</defs>",
+				"<use xlink:href=\"#shape0\" x=\"1\" y=\"2\"/>\n"
+				"<use xlink:href=\"#shape0\" x=\"5\" y=\"2\"/>\n"),
+				share_svg_paths(svg));
+	}
+
+	void testReferencesKept() {
+		// Gradients, patterns and clips stay where they are in user space,
+		// so paths using them cannot be moved.
+		std::string svg = document(
+				"<path style=\"fill:url(#linear0);\" d=\"M 1 1 L 2 2 \"/>\n"
+				"<path style=\"fill:url(#linear0);\" d=\"M 3 1 L 4 2 \"/>\n"
+				"<path clip-path=\"url(#clip0)\" d=\"M 1 1 L 2 2 \"/>\n"
+				"<path clip-path=\"url(#clip0)\" d=\"M 3 1 L 4 2 \"/>\n");
+		CPPUNIT_ASSERT_EQUAL(svg, share_svg_paths(svg));
+	}
+
+	void testXlinkDeclared() {
+		std::string svg = "<svg xmlns=\"http://www.w3.org/2000/svg\">\n"
+			"<path d=\"M 1 1 L 2 2 \"/>\n"
+			"<path d=\"M 1 1 L 2 2 \"/>\n"
+			"</svg>\n";
+		CPPUNIT_ASSERT_EQUAL(std::string(
+					"<svg xmlns=\"http://www.w3.org/2000/svg\" "
+					"xmlns:xlink=\"http://www.w3.org/1999/xlink\">\n"
+					"<defs>\n"
+					"<path id=\"shape0\" d=\"M 0 0 L 1 1 \"/>\n"
+					"</defs>\n"
+					"<use xlink:href=\"#shape0\" x=\"1\" y=\"1\"/>\n"
+					"<use xlink:href=\"#shape0\" x=\"1\" y=\"1\"/>\n"
+					"</svg>\n"),
+				share_svg_paths(svg));
+	}
+
+	// Runs on what the installed cairo writes, in whichever style it has.
+	void testCairoOutput() {
+		std::string svg;
+		cairo_surface_t *surface = cairo_svg_surface_create_for_stream(
+				append_to_string, &svg, 100, 100);
+		cairo_t *cr = cairo_create(surface);
+		// Two day cells and two crosses, as calendar.cpp draws them.
+		for (int i = 0; i < 2; i++) {
+			rounded_rectangle(cr, 10 + i * 20, 10, 16);
+			cairo_fill(cr);
+			cairo_set_line_width(cr, 0.5);
+			cairo_move_to(cr, 10 + i * 20, 40);
+			cairo_line_to(cr, 13 + i * 20, 43);
+			cairo_move_to(cr, 13 + i * 20, 40);
+			cairo_line_to(cr, 10 + i * 20, 43);
+			cairo_stroke(cr);
+		}
+		// And two cells filled with one gradient.
+		cairo_pattern_t *gradient =
+			cairo_pattern_create_linear(0, 60, 100, 60);
+		cairo_pattern_add_color_stop_rgb(gradient, 0, 1, 0, 0);
+		cairo_pattern_add_color_stop_rgb(gradient, 1, 0, 0, 1);
+		cairo_set_source(cr, gradient);
+		for (int i = 0; i < 2; i++) {
+			rounded_rectangle(cr, 10 + i * 20, 60, 16);
+			cairo_fill(cr);
+		}
+		cairo_pattern_destroy(gradient);
+		cairo_destroy(cr);
+		cairo_surface_finish(surface);
+		CPPUNIT_ASSERT_EQUAL(CAIRO_STATUS_SUCCESS,
+				cairo_surface_status(surface));
+		cairo_surface_destroy(surface);
+
+		std::string shared = share_svg_paths(svg);
+		CPPUNIT_ASSERT_EQUAL(2, count(shared, "<path id=\"shape"));
+		CPPUNIT_ASSERT_EQUAL(4, count(shared, "<use xlink:href=\"#shape"));
+		CPPUNIT_ASSERT_EQUAL(count(svg, "url(#"), count(shared, "url(#"));
+		CPPUNIT_ASSERT(shared.size() < svg.size());
+	}
+
+private:
+	static cairo_status_t append_to_string(void *closure,
+			const unsigned char *data, unsigned int length) {
+		static_cast<std::string*>(closure)->append(
+				reinterpret_cast<const char*>(data), length);
+		return CAIRO_STATUS_SUCCESS;
+	}
+
+	void rounded_rectangle(cairo_t *cr, double x, double y, double size) {
+		double r = size / 8;
+		cairo_new_sub_path(cr);
+		cairo_arc(cr, x + size - r, y + r, r, -M_PI / 2, 0);
+		cairo_arc(cr, x + size - r, y + size - r, r, 0, M_PI / 2);
+		cairo_arc(cr, x + r, y + size - r, r, M_PI / 2, M_PI);
+		cairo_arc(cr, x + r, y + r, r, M_PI, 3 * M_PI / 2);
+		cairo_close_path(cr);
+	}
+
+	int count(const std::string& s, const std::string& part) {
+		int n = 0;
+		for (size_t pos = s.find(part); pos != std::string::npos;
+				pos = s.find(part, pos + 1)) {
+			n++;
+		}
+		return n;
+	}
+
+	std::string document(const std::string& body) {
+		return document("", body);
+	}
+
+	std::string document(const std::string& defs, const std::string& body) {
+		return "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+			"<svg xmlns=\"http://www.w3.org/2000/svg\" "
+			"xmlns:xlink=\"http://www.w3.org/1999/xlink\">" + defs + "\n" +
+			body + "</svg>\n";
+	}
+};
+CPPUNIT_TEST_SUITE_REGISTRATION(TestSvgDefs);
+
+int main(int argc, char* argv[])
+{
+	CppUnit::TextUi::TestRunner runner;
+	runner.addTest(CppUnit::TestFactoryRegistry::getRegistry().makeTest());
+	return !runner.run();
+}